@@ -0,0 +1,134 @@
+/************************************************************************
+**
+**
+** File: simple_robot_app_shm.h
+**
+** Purpose:
+**  Layout of the optional shared-memory joint state segment, and a small
+**  header-only reader for processes on the same host.
+**
+** Notes:
+**  The app rewrites the segment on every HR tick under a seqlock: Seq is
+**  odd while an update is in progress. Readers never block the writer;
+**  SimpleRobotAppShmTryRead makes a single bounded attempt and fails if it
+**  raced with an update.
+**
+**  This header does not depend on cFE so it can be used from ROS2 nodes.
+**
+*************************************************************************/
+#ifndef _simple_robot_app_shm_h_
+#define _simple_robot_app_shm_h_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifndef SIMPLE_ROBOT_APP_SHM_NAME
+#define SIMPLE_ROBOT_APP_SHM_NAME "/simple_robot_app_state"
+#endif
+#define SIMPLE_ROBOT_APP_SHM_MAGIC   0x53524153u /* "SRAS" */
+#define SIMPLE_ROBOT_APP_SHM_VERSION 1
+#define SIMPLE_ROBOT_APP_SHM_JOINTS  6
+
+/* Joint order matches SimpleRobotAppJointConfig_t */
+typedef struct
+{
+    uint32_t tick; /**< \brief HR tick count when the snapshot was taken */
+    float    goal[SIMPLE_ROBOT_APP_SHM_JOINTS];
+    float    state[SIMPLE_ROBOT_APP_SHM_JOINTS];
+} SimpleRobotAppShmState_t;
+
+typedef struct
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Seq; /**< \brief Odd while the writer is updating Data */
+    uint32_t Spare;
+    SimpleRobotAppShmState_t Data;
+} SimpleRobotAppShmSegment_t;
+
+/*
+** Map the segment read-only. Returns NULL if the app is not publishing or
+** the segment layout does not match this header.
+*/
+static inline const SimpleRobotAppShmSegment_t *SimpleRobotAppShmAttach(void)
+{
+    void *Addr;
+    int   Fd;
+
+    Fd = shm_open(SIMPLE_ROBOT_APP_SHM_NAME, O_RDONLY, 0);
+    if (Fd < 0)
+    {
+        return NULL;
+    }
+
+    Addr = mmap(NULL, sizeof(SimpleRobotAppShmSegment_t), PROT_READ, MAP_SHARED, Fd, 0);
+    close(Fd);
+    if (Addr == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    if (((const SimpleRobotAppShmSegment_t *)Addr)->Magic != SIMPLE_ROBOT_APP_SHM_MAGIC ||
+        ((const SimpleRobotAppShmSegment_t *)Addr)->Version != SIMPLE_ROBOT_APP_SHM_VERSION)
+    {
+        munmap(Addr, sizeof(SimpleRobotAppShmSegment_t));
+        return NULL;
+    }
+
+    return (const SimpleRobotAppShmSegment_t *)Addr;
+}
+
+static inline void SimpleRobotAppShmDetach(const SimpleRobotAppShmSegment_t *Seg)
+{
+    munmap((void *)Seg, sizeof(SimpleRobotAppShmSegment_t));
+}
+
+/*
+** Single read attempt. Returns false, leaving Out unusable, if the writer
+** was mid-update; the caller decides whether to retry.
+*/
+static inline bool SimpleRobotAppShmTryRead(const SimpleRobotAppShmSegment_t *Seg, SimpleRobotAppShmState_t *Out)
+{
+    uint32_t Before;
+    uint32_t After;
+
+    Before = __atomic_load_n(&Seg->Seq, __ATOMIC_ACQUIRE);
+    if (Before & 1u)
+    {
+        return false;
+    }
+
+    memcpy(Out, (const void *)&Seg->Data, sizeof(*Out));
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    After = __atomic_load_n(&Seg->Seq, __ATOMIC_RELAXED);
+
+    return Before == After;
+}
+
+/* Retry up to MaxTries times; an update takes well under a microsecond */
+static inline bool SimpleRobotAppShmRead(const SimpleRobotAppShmSegment_t *Seg, SimpleRobotAppShmState_t *Out,
+                                         unsigned int MaxTries)
+{
+    unsigned int Try;
+
+    for (Try = 0; Try < MaxTries; Try++)
+    {
+        if (SimpleRobotAppShmTryRead(Seg, Out))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#endif /* _simple_robot_app_shm_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
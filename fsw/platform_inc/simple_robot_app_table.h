@@ -12,13 +12,37 @@
 #ifndef _simple_robot_app_table_h_
 #define _simple_robot_app_table_h_
 
+#define SIMPLE_ROBOT_APP_MAX_RATE_GROUPS 4
+#define SIMPLE_ROBOT_APP_MAX_GROUP_TASKS 4
+
+/**
+ * Tasks that can be placed in a rate group
+ */
+#define SIMPLE_ROBOT_APP_TASK_NONE        0
+#define SIMPLE_ROBOT_APP_TASK_TLM_MOTION  1 /**< \brief Publish joint telemetry while the arm is moving */
+#define SIMPLE_ROBOT_APP_TASK_DIAG_ROLLUP 2 /**< \brief Copy scheduler, latency and worker statistics into telemetry */
+#define SIMPLE_ROBOT_APP_TASK_COUNT       3
+
+/**
+ * Rate group definition, run every Divisor HR ticks
+ */
+typedef struct
+{
+   uint16 Divisor;    /**< \brief HR ticks between runs (0 = group disabled) */
+   uint16 BudgetUsec; /**< \brief Run time above which a run counts as an overrun (0 = no budget) */
+   uint8  TaskId[SIMPLE_ROBOT_APP_MAX_GROUP_TASKS]; /**< \brief Tasks run in order, SIMPLE_ROBOT_APP_TASK_NONE ends the list */
+} SimpleRobotAppRateGroupConfig_t;
+
 /**
  * Table structure
  */
 typedef struct
 {
-   uint16 Int1;
-   uint16 Int2;
+   float  TlmDeadband;      /**< \brief Joint change (rad) since the last send that triggers a new send */
+   uint16 TlmMaxIntervalHk; /**< \brief Max HK requests between sends while at rest (0 or 1 = every HK) */
+   float  ConvergeTolerance; /**< \brief Max joint error (rad) at which the goal counts as reached (0 = never idle) */
+   float  JointPositionLimit; /**< \brief Goals are clamped to +/- this many rad per joint (0 = no limit; fixed-point builds need (0, SIMPLE_ROBOT_APP_Q_LIMIT_RAD]) */
+   SimpleRobotAppRateGroupConfig_t RateGroup[SIMPLE_ROBOT_APP_MAX_RATE_GROUPS];
 } SimpleRobotAppTable_t;
 
 #endif /* _simple_robot_app_table_h_ */
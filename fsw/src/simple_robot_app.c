@@ -32,6 +32,7 @@
 #include "simple_robot_app_version.h"
 #include "simple_robot_app.h"
 #include "simple_robot_app_table.h"
+#include "cfe_psp.h"
 
 #include <string.h>
 
@@ -44,6 +45,30 @@ SimpleRobotAppData_t SimpleRobotAppData;
 
 void HighRateControLoop(void);
 
+/*
+** Ground command dispatch table, generated from SIMPLE_ROBOT_APP_COMMAND_LIST
+*/
+typedef struct
+{
+    size_t ExpectedLength;
+    int32 (*Handler)(const SimpleRobotAppCmdBuffer_t *CmdBuf);
+} SimpleRobotAppCmdEntry_t;
+
+#define SIMPLE_ROBOT_APP_CMD_DISPATCH(Name, Type, Handler)                                   \
+    static int32 SimpleRobotAppDispatch_##Name(const SimpleRobotAppCmdBuffer_t *CmdBuf) \
+    {                                                                                    \
+        return Handler(&CmdBuf->Name);                                                   \
+    }
+SIMPLE_ROBOT_APP_COMMAND_LIST(SIMPLE_ROBOT_APP_CMD_DISPATCH)
+#undef SIMPLE_ROBOT_APP_CMD_DISPATCH
+
+#define SIMPLE_ROBOT_APP_CMD_ENTRY(Name, Type, Handler) \
+    [SIMPLE_ROBOT_APP_##Name##_CC] = {sizeof(Type), SimpleRobotAppDispatch_##Name},
+static const SimpleRobotAppCmdEntry_t SimpleRobotAppCmdTable[SIMPLE_ROBOT_APP_NUM_COMMANDS] = {
+    SIMPLE_ROBOT_APP_COMMAND_LIST(SIMPLE_ROBOT_APP_CMD_ENTRY)
+};
+#undef SIMPLE_ROBOT_APP_CMD_ENTRY
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * *  * * * * **/
 /* SimpleRobotAppMain() -- Application entry point and main process loop      */
 /*                                                                            */
@@ -106,6 +131,10 @@ void SimpleRobotAppMain(void)
     */
     CFE_ES_PerfLogExit(SIMPLE_ROBOT_APP_PERF_ID);
 
+#ifdef SIMPLE_ROBOT_APP_SHM_STATE
+    SimpleRobotAppShmClose();
+#endif
+
     CFE_ES_ExitApp(SimpleRobotAppData.RunStatus);
 
 } /* End of SimpleRobotAppMain() */
@@ -120,6 +149,18 @@ void fillJoints(SimpleRobotAppJointConfig_t *_joints, float j0, float j1, float
  _joints->wrist_3_joint = j5;
 }
 
+/* Largest absolute per-joint difference between two joint configurations */
+float maxJointDelta(const SimpleRobotAppJointConfig_t *a, const SimpleRobotAppJointConfig_t *b)
+{
+    float delta = fabsf(a->shoulder_pan_joint - b->shoulder_pan_joint);
+    delta = fmaxf(delta, fabsf(a->shoulder_lift_joint - b->shoulder_lift_joint));
+    delta = fmaxf(delta, fabsf(a->elbow_joint - b->elbow_joint));
+    delta = fmaxf(delta, fabsf(a->wrist_1_joint - b->wrist_1_joint));
+    delta = fmaxf(delta, fabsf(a->wrist_2_joint - b->wrist_2_joint));
+    delta = fmaxf(delta, fabsf(a->wrist_3_joint - b->wrist_3_joint));
+    return delta;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
 /*                                                                            */
 /* SimpleRobotAppInit() --  initialization                                    */
@@ -139,8 +180,12 @@ int32 SimpleRobotAppInit(void)
     SimpleRobotAppData.square_counter = 0;
     SimpleRobotAppData.hk_counter = 0;
 
-    // Initialize telemetry data back to ground
-    fillJoints(&SimpleRobotAppData.JointTlm.joint_state, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+    // Goal and state both start at zero
+    SimpleRobotAppData.Converged = true;
+    SimpleRobotAppControlInit(&SimpleRobotAppData.Control);
+    memset(&SimpleRobotAppData.Latency, 0, sizeof(SimpleRobotAppData.Latency));
+    SimpleRobotAppData.HkSinceSend = 0;
+    memset(&SimpleRobotAppData.Sched, 0, sizeof(SimpleRobotAppData.Sched));
       
     /*
     ** Initialize app configuration data
@@ -151,22 +196,16 @@ int32 SimpleRobotAppInit(void)
     SimpleRobotAppData.PipeName[sizeof(SimpleRobotAppData.PipeName) - 1] = 0;
 
     /*
-    ** Initialize event filter table...
+    ** Initialize event filter table. Only events that can repeat at the goal
+    ** rate are listed; everything else is unfiltered. Goal drops and arrivals
+    ** are also counted in telemetry, so nothing is lost once these stop.
     */
-    SimpleRobotAppData.EventFilters[0].EventID = SIMPLE_ROBOT_APP_STARTUP_INF_EID;
-    SimpleRobotAppData.EventFilters[0].Mask    = 0x0000;
-    SimpleRobotAppData.EventFilters[1].EventID = SIMPLE_ROBOT_APP_COMMAND_ERR_EID;
-    SimpleRobotAppData.EventFilters[1].Mask    = 0x0000;
-    SimpleRobotAppData.EventFilters[2].EventID = SIMPLE_ROBOT_APP_COMMANDNOP_INF_EID;
-    SimpleRobotAppData.EventFilters[2].Mask    = 0x0000;
-    SimpleRobotAppData.EventFilters[3].EventID = SIMPLE_ROBOT_APP_COMMANDMODE_INF_EID;
-    SimpleRobotAppData.EventFilters[3].Mask    = 0x0000;
-    SimpleRobotAppData.EventFilters[4].EventID = SIMPLE_ROBOT_APP_INVALID_MSGID_ERR_EID;
-    SimpleRobotAppData.EventFilters[4].Mask    = 0x0000;
-    SimpleRobotAppData.EventFilters[5].EventID = SIMPLE_ROBOT_APP_LEN_ERR_EID;
-    SimpleRobotAppData.EventFilters[5].Mask    = 0x0000;
-    SimpleRobotAppData.EventFilters[6].EventID = SIMPLE_ROBOT_APP_PIPE_ERR_EID;
-    SimpleRobotAppData.EventFilters[6].Mask    = 0x0000;
+    SimpleRobotAppData.EventFilters[0].EventID = SIMPLE_ROBOT_APP_COMMANDMODE_INF_EID;
+    SimpleRobotAppData.EventFilters[0].Mask    = CFE_EVS_FIRST_16_STOP;
+    SimpleRobotAppData.EventFilters[1].EventID = SIMPLE_ROBOT_APP_GOAL_REACHED_INF_EID;
+    SimpleRobotAppData.EventFilters[1].Mask    = CFE_EVS_FIRST_16_STOP;
+    SimpleRobotAppData.EventFilters[2].EventID = SIMPLE_ROBOT_APP_WORKER_ERR_EID;
+    SimpleRobotAppData.EventFilters[2].Mask    = CFE_EVS_FIRST_8_STOP;
 
     status = CFE_EVS_Register(SimpleRobotAppData.EventFilters, SIMPLE_ROBOT_APP_EVENT_COUNTS, CFE_EVS_EventFilter_BINARY);
     if (status != CFE_SUCCESS)
@@ -180,6 +219,37 @@ int32 SimpleRobotAppInit(void)
     */
     CFE_MSG_Init(&SimpleRobotAppData.JointTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(SIMPLE_ROBOT_APP_HK_TLM_MID), sizeof(SimpleRobotAppData.JointTlm));
 
+    // Initialize telemetry data back to ground (CFE_MSG_Init clears the whole packet)
+    fillJoints(&SimpleRobotAppData.JointTlm.joint_state, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+    SimpleRobotAppData.JointTlm.tlm_sent_count = 0;
+    SimpleRobotAppData.JointTlm.tlm_suppressed_count = 0;
+    SimpleRobotAppData.JointTlm.goal_reached = 1;
+    SimpleRobotAppData.LastSentState = SimpleRobotAppData.JointTlm.joint_state;
+
+    /*
+    ** Register and load the config table
+    */
+    status = CFE_TBL_Register(&SimpleRobotAppData.TblHandle, SIMPLE_ROBOT_APP_TABLE_NAME, sizeof(SimpleRobotAppTable_t),
+                              CFE_TBL_OPT_DEFAULT, SimpleRobotAppTblValidationFunc);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SimpleRobotApp: Error Registering Table, RC = 0x%08lX\n", (unsigned long)status);
+        return (status);
+    }
+
+    status = CFE_TBL_Load(SimpleRobotAppData.TblHandle, CFE_TBL_SRC_FILE, SIMPLE_ROBOT_APP_TABLE_FILE);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SimpleRobotApp: Error Loading Table, RC = 0x%08lX\n", (unsigned long)status);
+        return (status);
+    }
+
+    status = SimpleRobotAppManageTable();
+    if (status != CFE_SUCCESS)
+    {
+        return (status);
+    }
+
     /*
     ** Create Software Bus message pipe.
     */
@@ -222,6 +292,22 @@ int32 SimpleRobotAppInit(void)
         return (status);
     }
 
+    /*
+    ** Start the goal preprocessing worker
+    */
+    status = SimpleRobotAppWorkerInit();
+    if (status != CFE_SUCCESS)
+    {
+        return (status);
+    }
+
+#ifdef SIMPLE_ROBOT_APP_SHM_STATE
+    /*
+    ** Local state segment is optional, the app runs without it
+    */
+    SimpleRobotAppShmOpen();
+#endif
+
     CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_STARTUP_INF_EID, CFE_EVS_EventType_INFORMATION, "SimpleRobotApp Initialized.%s",
                       SIMPLE_ROBOT_APP_VERSION_STRING);
 
@@ -278,7 +364,10 @@ void SimpleRobotAppProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 void SimpleRobotAppProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_MSG_FcnCode_t CommandCode = 0;
+    CFE_MSG_FcnCode_t               CommandCode = 0;
+    const SimpleRobotAppCmdEntry_t *Entry;
+    OS_time_t                       Start;
+    OS_time_t                       End;
 
     CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &CommandCode);
 
@@ -287,32 +376,25 @@ void SimpleRobotAppProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
     /*
     ** Process "known" SimpleRobotApp ground commands
     */
-    switch (CommandCode)
+    if (CommandCode >= SIMPLE_ROBOT_APP_NUM_COMMANDS)
     {
-        case SIMPLE_ROBOT_APP_NOOP_CC:
-            if (SimpleRobotAppVerifyCmdLength(&SBBufPtr->Msg, sizeof(SimpleRobotAppNoopCmd_t)))
-            {
-                SimpleRobotAppNoop((SimpleRobotAppNoopCmd_t *)SBBufPtr);
-            }
-
-            break;
-
-        case SIMPLE_ROBOT_APP_CMD_CC:
-            if (SimpleRobotAppVerifyCmdLength(&SBBufPtr->Msg, sizeof(SimpleRobotAppCmd_t)))
-            {
-                updateRobotCommand((SimpleRobotAppCmd_t *)SBBufPtr);
-            }
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_COMMAND_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Invalid ground command code: CC = %d", CommandCode);
+        return;
+    }
 
-            break;
+    Entry = &SimpleRobotAppCmdTable[CommandCode];
+    if (SimpleRobotAppVerifyCmdLength(&SBBufPtr->Msg, Entry->ExpectedLength))
+    {
+        CFE_PSP_GetTime(&Start);
+        Entry->Handler((const SimpleRobotAppCmdBuffer_t *)SBBufPtr);
+        CFE_PSP_GetTime(&End);
 
-        /* default case already found during FC vs length test */
-        default:
-            CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_COMMAND_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Invalid ground command code: CC = %d", CommandCode);
-            break;
+        SimpleRobotAppData.JointTlm.cmd_stats[CommandCode].invoke_count++;
+        SimpleRobotAppData.JointTlm.cmd_stats[CommandCode].total_usec +=
+            (uint32)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(End, Start));
     }
 
-
     return;
 
 } /* End of SimpleRobotAppProcessGroundCommand() */
@@ -331,13 +413,152 @@ int32 SimpleRobotAppReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg)
 {        
     SimpleRobotAppData.CmdCounter++;
     OS_printf("SimpleRobotAppReportHousekeeping reporting: %d\n", SimpleRobotAppData.CmdCounter);
-    
+
+    SimpleRobotAppManageTable();
+
+    /*
+    ** Only send when a joint moved past the deadband since the last packet,
+    ** or when the arm has been quiet for TlmMaxIntervalHk requests
+    */
+    SimpleRobotAppData.HkSinceSend++;
+    SimpleRobotAppControlGetState(&SimpleRobotAppData.Control, &SimpleRobotAppData.JointTlm.joint_state);
+    if (SimpleRobotAppData.HkSinceSend >= SimpleRobotAppData.Config.TlmMaxIntervalHk ||
+        maxJointDelta(&SimpleRobotAppData.JointTlm.joint_state, &SimpleRobotAppData.LastSentState) >
+            SimpleRobotAppData.Config.TlmDeadband)
+    {
+        SimpleRobotAppSendJointTlm();
+    }
+    else
+    {
+        SimpleRobotAppData.JointTlm.tlm_suppressed_count++;
+    }
+
+    return CFE_SUCCESS;
+
+} /* End of SimpleRobotAppReportHousekeeping() */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppSendJointTlm() -- Transmit the joint packet                  */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppSendJointTlm(void)
+{
+    SimpleRobotAppData.JointTlm.tlm_sent_count++;
+    SimpleRobotAppControlGetState(&SimpleRobotAppData.Control, &SimpleRobotAppData.JointTlm.joint_state);
+
     CFE_SB_TimeStampMsg(&SimpleRobotAppData.JointTlm.TlmHeader.Msg);
     CFE_SB_TransmitMsg(&SimpleRobotAppData.JointTlm.TlmHeader.Msg, true);
 
+    SimpleRobotAppData.LastSentState = SimpleRobotAppData.JointTlm.joint_state;
+    SimpleRobotAppData.HkSinceSend   = 0;
+
+} /* End of SimpleRobotAppSendJointTlm() */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppManageTable() -- Apply pending table updates and refresh     */
+/*                                the local config copy                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 SimpleRobotAppManageTable(void)
+{
+    int32                  status;
+    SimpleRobotAppTable_t *TblPtr = NULL;
+
+    CFE_TBL_Manage(SimpleRobotAppData.TblHandle);
+
+    status = CFE_TBL_GetAddress((void **)&TblPtr, SimpleRobotAppData.TblHandle);
+    if (status != CFE_SUCCESS && status != CFE_TBL_INFO_UPDATED)
+    {
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: Fail to get table address, RC = 0x%08lX", (unsigned long)status);
+        return status;
+    }
+
+    SimpleRobotAppData.Config = *TblPtr;
+    SimpleRobotAppControlSetTolerance(&SimpleRobotAppData.Control, SimpleRobotAppData.Config.ConvergeTolerance);
+
+    CFE_TBL_ReleaseAddress(SimpleRobotAppData.TblHandle);
+
+    if (status == CFE_TBL_INFO_UPDATED)
+    {
+        SimpleRobotAppSchedConfigure(&SimpleRobotAppData.Sched, SimpleRobotAppData.Config.RateGroup);
+        if (SimpleRobotAppData.Sched.PhaseConflicts > 0)
+        {
+            CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SimpleRobotApp: %u rate group(s) share ticks with another group",
+                              (unsigned int)SimpleRobotAppData.Sched.PhaseConflicts);
+        }
+    }
+
     return CFE_SUCCESS;
 
-} /* End of SimpleRobotAppReportHousekeeping() */
+} /* End of SimpleRobotAppManageTable() */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppTblValidationFunc() -- Verify contents of a table load       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 SimpleRobotAppTblValidationFunc(void *TblData)
+{
+    SimpleRobotAppTable_t *TblPtr = (SimpleRobotAppTable_t *)TblData;
+    uint16                 g;
+    uint16                 t;
+
+    if (!(TblPtr->TlmDeadband >= 0.0f))
+    {
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: Invalid table, TlmDeadband must be >= 0");
+        return SIMPLE_ROBOT_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    if (!(TblPtr->ConvergeTolerance >= 0.0f))
+    {
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: Invalid table, ConvergeTolerance must be >= 0");
+        return SIMPLE_ROBOT_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    if (!(TblPtr->JointPositionLimit >= 0.0f))
+    {
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: Invalid table, JointPositionLimit must be >= 0");
+        return SIMPLE_ROBOT_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+#ifdef SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL
+    /* The fixed-point kernel cannot represent goals past its own range */
+    if (TblPtr->JointPositionLimit == 0.0f || TblPtr->JointPositionLimit > SIMPLE_ROBOT_APP_Q_LIMIT_RAD)
+    {
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: Invalid table, JointPositionLimit must be in (0, %g] in fixed-point builds",
+                          (double)SIMPLE_ROBOT_APP_Q_LIMIT_RAD);
+        return SIMPLE_ROBOT_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+#endif
+
+    for (g = 0; g < SIMPLE_ROBOT_APP_MAX_RATE_GROUPS; g++)
+    {
+        for (t = 0; t < SIMPLE_ROBOT_APP_MAX_GROUP_TASKS; t++)
+        {
+            if (TblPtr->RateGroup[g].TaskId[t] >= SIMPLE_ROBOT_APP_TASK_COUNT)
+            {
+                CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "SimpleRobotApp: Invalid table, rate group %u has unknown task %u", (unsigned int)g,
+                                  (unsigned int)TblPtr->RateGroup[g].TaskId[t]);
+                return SIMPLE_ROBOT_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+            }
+        }
+    }
+
+    return CFE_SUCCESS;
+
+} /* End of SimpleRobotAppTblValidationFunc() */
 
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
@@ -356,12 +577,30 @@ int32 SimpleRobotAppNoop(const SimpleRobotAppNoopCmd_t *Msg)
 
 int32 updateRobotCommand(const SimpleRobotAppCmd_t *Msg)
 {
-   SimpleRobotAppData.JointCmd.joint_goal.shoulder_pan_joint = Msg->joint_goal.shoulder_pan_joint;
-   SimpleRobotAppData.JointCmd.joint_goal.shoulder_lift_joint = Msg->joint_goal.shoulder_lift_joint;
-   SimpleRobotAppData.JointCmd.joint_goal.elbow_joint = Msg->joint_goal.elbow_joint;
-   SimpleRobotAppData.JointCmd.joint_goal.wrist_1_joint = Msg->joint_goal.wrist_1_joint;
-   SimpleRobotAppData.JointCmd.joint_goal.wrist_2_joint = Msg->joint_goal.wrist_2_joint;
-   SimpleRobotAppData.JointCmd.joint_goal.wrist_3_joint = Msg->joint_goal.wrist_3_joint;
+   SimpleRobotAppSegment_t Request;
+   OS_time_t               RxWallClock;
+
+   // Wall clock only for comparing with the sender's stamp, in-app stages use the PSP clock
+   OS_GetLocalTime(&RxWallClock);
+   CFE_PSP_GetTime(&Request.Received);
+
+   // The worker task limit-checks the goal and hands it to the control loop.
+   // A goal dropped on a full queue is not reported as the latest goal.
+   Request.Goal          = Msg->joint_goal;
+   Request.PositionLimit = SimpleRobotAppData.Config.JointPositionLimit;
+   if (!SimpleRobotAppWorkerSubmit(&Request))
+   {
+       return CFE_SUCCESS;
+   }
+
+   // Senders that do not stamp their goals leave the bridge stage alone
+   if (Msg->stamp_sec != 0 || Msg->stamp_nsec != 0)
+   {
+       SimpleRobotAppLatencyAdd(&SimpleRobotAppData.Latency.Stage[SIMPLE_ROBOT_APP_LATENCY_BRIDGE],
+                                SimpleRobotAppLatencyUsec(OS_TimeAssembleFromNanoseconds(Msg->stamp_sec, Msg->stamp_nsec),
+                                                          RxWallClock));
+   }
+   SimpleRobotAppData.JointTlm.last_goal_seq = Msg->goal_seq;
             
    CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_COMMANDMODE_INF_EID, CFE_EVS_EventType_INFORMATION, "SimpleRobotApp: Received command %s",
                      SIMPLE_ROBOT_APP_VERSION);
@@ -371,25 +610,108 @@ int32 updateRobotCommand(const SimpleRobotAppCmd_t *Msg)
 }
 
 void HighRateControLoop(void) {
-    
-    float errors[6];
-    errors[0] = (SimpleRobotAppData.JointCmd.joint_goal.shoulder_pan_joint - SimpleRobotAppData.JointTlm.joint_state.shoulder_pan_joint);
-    errors[1] = (SimpleRobotAppData.JointCmd.joint_goal.shoulder_lift_joint - SimpleRobotAppData.JointTlm.joint_state.shoulder_lift_joint);
-    errors[2] = (SimpleRobotAppData.JointCmd.joint_goal.elbow_joint - SimpleRobotAppData.JointTlm.joint_state.elbow_joint);
-    errors[3] = (SimpleRobotAppData.JointCmd.joint_goal.wrist_1_joint - SimpleRobotAppData.JointTlm.joint_state.wrist_1_joint);
-    errors[4] = (SimpleRobotAppData.JointCmd.joint_goal.wrist_2_joint - SimpleRobotAppData.JointTlm.joint_state.wrist_2_joint);
-    errors[5] = (SimpleRobotAppData.JointCmd.joint_goal.wrist_3_joint - SimpleRobotAppData.JointTlm.joint_state.wrist_3_joint);
-
-    // Update state (telemetry) stored. It will be sent back to a lower rate
-    // (when a Housekeeping request is received)
-    float Kp = 0.01;
-    SimpleRobotAppData.JointTlm.joint_state.shoulder_pan_joint += + Kp * errors[0];
-    SimpleRobotAppData.JointTlm.joint_state.shoulder_lift_joint += + Kp * errors[1];    
-    SimpleRobotAppData.JointTlm.joint_state.elbow_joint += Kp * errors[2];    
-    SimpleRobotAppData.JointTlm.joint_state.wrist_1_joint += Kp * errors[3];        
-    SimpleRobotAppData.JointTlm.joint_state.wrist_2_joint += Kp * errors[4];
-    SimpleRobotAppData.JointTlm.joint_state.wrist_3_joint += Kp * errors[5];
-              
+
+    SimpleRobotAppSegment_t Segment;
+
+    // Pick up the next goal the worker has finished preprocessing
+    if (SimpleRobotAppWorkerNextSegment(&Segment))
+    {
+        SimpleRobotAppData.JointCmd.joint_goal = Segment.Goal;
+        SimpleRobotAppControlSetGoal(&SimpleRobotAppData.Control, &SimpleRobotAppData.JointCmd.joint_goal);
+
+        SimpleRobotAppData.Latency.Received     = Segment.Received;
+        SimpleRobotAppData.Latency.PendingApply = true;
+
+        SimpleRobotAppData.Converged = false;
+        SimpleRobotAppData.JointTlm.goal_reached = 0;
+    }
+
+    // At rest on the current goal: nothing to compute until a new goal arrives
+    if (!SimpleRobotAppData.Converged)
+    {
+        if (SimpleRobotAppData.Latency.PendingApply)
+        {
+            CFE_PSP_GetTime(&SimpleRobotAppData.Latency.Applied);
+            SimpleRobotAppLatencyAdd(&SimpleRobotAppData.Latency.Stage[SIMPLE_ROBOT_APP_LATENCY_APPLY],
+                                     SimpleRobotAppLatencyUsec(SimpleRobotAppData.Latency.Received,
+                                                               SimpleRobotAppData.Latency.Applied));
+            SimpleRobotAppData.Latency.PendingApply = false;
+        }
+
+        // The controller owns the state; telemetry picks it up when a packet
+        // goes out (HK request, motion task or goal reached)
+        if (SimpleRobotAppControlStep(&SimpleRobotAppData.Control, &SimpleRobotAppData.JointCmd.joint_goal))
+        {
+            OS_time_t Reached;
+
+            SimpleRobotAppData.Converged = true;
+            SimpleRobotAppData.JointTlm.goal_reached = 1;
+
+            CFE_PSP_GetTime(&Reached);
+            SimpleRobotAppLatencyAdd(&SimpleRobotAppData.Latency.Stage[SIMPLE_ROBOT_APP_LATENCY_CONVERGE],
+                                     SimpleRobotAppLatencyUsec(SimpleRobotAppData.Latency.Applied, Reached));
+
+            CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_GOAL_REACHED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "SimpleRobotApp: Goal reached");
+
+            // Report the final state right away rather than waiting on the deadband
+            SimpleRobotAppSendJointTlm();
+        }
+    }
+
+#ifdef SIMPLE_ROBOT_APP_SHM_STATE
+    SimpleRobotAppControlGetState(&SimpleRobotAppData.Control, &SimpleRobotAppData.JointTlm.joint_state);
+    SimpleRobotAppShmPublish(SimpleRobotAppData.Sched.TickCount, &SimpleRobotAppData.JointCmd.joint_goal,
+                             &SimpleRobotAppData.JointTlm.joint_state);
+#endif
+
+    SimpleRobotAppSchedTick(&SimpleRobotAppData.Sched);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppTlmMotionTask() -- Rate group task: publish joint telemetry  */
+/*                                  while the arm moves past the deadband     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppTlmMotionTask(void)
+{
+    SimpleRobotAppControlGetState(&SimpleRobotAppData.Control, &SimpleRobotAppData.JointTlm.joint_state);
+    if (maxJointDelta(&SimpleRobotAppData.JointTlm.joint_state, &SimpleRobotAppData.LastSentState) >
+        SimpleRobotAppData.Config.TlmDeadband)
+    {
+        SimpleRobotAppSendJointTlm();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppDiagRollupTask() -- Rate group task: copy scheduler, latency */
+/*                                   and worker stats into telemetry          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppDiagRollupTask(void)
+{
+    uint16 g;
+
+    for (g = 0; g < SIMPLE_ROBOT_APP_MAX_RATE_GROUPS; g++)
+    {
+        const SimpleRobotAppRateGroup_t *Group = &SimpleRobotAppData.Sched.Group[g];
+
+        SimpleRobotAppData.JointTlm.rate_group[g].run_count     = Group->RunCount;
+        SimpleRobotAppData.JointTlm.rate_group[g].overrun_count = Group->OverrunCount;
+        SimpleRobotAppData.JointTlm.rate_group[g].last_usec     = Group->LastUsec;
+        SimpleRobotAppData.JointTlm.rate_group[g].max_usec      = Group->MaxUsec;
+    }
+
+    for (g = 0; g < SIMPLE_ROBOT_APP_LATENCY_STAGES; g++)
+    {
+        SimpleRobotAppLatencyRollup(&SimpleRobotAppData.Latency.Stage[g], &SimpleRobotAppData.JointTlm.latency[g]);
+    }
+
+    SimpleRobotAppData.JointTlm.goal_dropped_count =
+        SimpleRobotAppData.Worker.RequestDropCount + SimpleRobotAppData.Worker.ReadyDropCount;
+    SimpleRobotAppData.JointTlm.goal_limited_count = SimpleRobotAppData.Worker.LimitedCount;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
@@ -41,11 +41,22 @@
 #include "simple_robot_app_perfids.h"
 #include "simple_robot_app_msgids.h"
 #include "simple_robot_app_msg.h"
+#include "simple_robot_app_table.h"
+#include "simple_robot_app_sched.h"
+#include "simple_robot_app_latency.h"
+#include "simple_robot_app_control.h"
+#include "simple_robot_app_worker.h"
+#include "simple_robot_app_shm_writer.h"
 
 // #include "simple_robot_app_msgids.h"
 
 /***********************************************************************/
 #define SIMPLE_ROBOT_APP_PIPE_DEPTH 32 /* Depth of the Command Pipe for Application */
+
+#define SIMPLE_ROBOT_APP_TABLE_NAME "SimpleRobotAppTable"
+#define SIMPLE_ROBOT_APP_TABLE_FILE "/cf/simple_robot_app_tbl.tbl"
+
+#define SIMPLE_ROBOT_APP_TABLE_OUT_OF_RANGE_ERR_CODE -1
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
@@ -68,6 +79,26 @@ typedef struct
     SimpleRobotAppTlm_t JointTlm;
     // Command joint goal received from ground
     SimpleRobotAppCmd_t JointCmd;
+
+    // Joint state carried by the last packet actually transmitted
+    SimpleRobotAppJointConfig_t LastSentState;
+    uint16 HkSinceSend;    // HK requests answered without a send
+
+    // Controller kernel state (float or fixed-point, chosen at build time)
+    SimpleRobotAppControl_t Control;
+
+    // Set once the state reaches the goal, cleared by a new goal.
+    // The control loop skips all joint updates while it is set.
+    bool Converged;
+
+    // Receive / apply / converge timing of goals
+    SimpleRobotAppLatency_t Latency;
+
+    // Goal preprocessing child task and its queues
+    SimpleRobotAppWorker_t Worker;
+
+    // Rate groups run from the HR wakeup
+    SimpleRobotAppSched_t Sched;
     
     // Run Status variable used in the main processing loop
     uint32 RunStatus;
@@ -77,6 +108,10 @@ typedef struct
     */
     CFE_SB_PipeId_t CommandPipe;
 
+    CFE_TBL_Handle_t TblHandle;
+    // Copy of the config table, refreshed on every HK request
+    SimpleRobotAppTable_t Config;
+
     /*
     ** Initialization data (not reported in housekeeping)...
     */
@@ -87,6 +122,8 @@ typedef struct
 
 } SimpleRobotAppData_t;
 
+extern SimpleRobotAppData_t SimpleRobotAppData;
+
 /****************************************************************************/
 /*
 ** Local function prototypes.
@@ -102,6 +139,12 @@ void  SimpleRobotAppProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr);
 void  SimpleRobotAppProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr);
 
 int32 SimpleRobotAppReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg);
+void  SimpleRobotAppSendJointTlm(void);
+int32 SimpleRobotAppManageTable(void);
+int32 SimpleRobotAppTblValidationFunc(void *TblData);
+
+void  SimpleRobotAppTlmMotionTask(void);
+void  SimpleRobotAppDiagRollupTask(void);
 void SimpleRobotAppProcessRobotState(CFE_SB_Buffer_t *SBBufPtr);
 
 int32 SimpleRobotAppNoop(const SimpleRobotAppNoopCmd_t *Msg);
@@ -109,5 +152,6 @@ int32 updateRobotCommand(const SimpleRobotAppCmd_t *Msg);
 
 bool SimpleRobotAppVerifyCmdLength(CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
 void fillJoints(SimpleRobotAppJointConfig_t *_joints, float j0, float j1, float j2, float j3, float j4, float j5);
+float maxJointDelta(const SimpleRobotAppJointConfig_t *a, const SimpleRobotAppJointConfig_t *b);
 
 #endif /* _SIMPLE_ROBOT_APP_h_ */
@@ -0,0 +1,159 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_control.c
+**
+** Purpose:
+**   Joint controller kernels, float or fixed-point depending on the build.
+**
+*******************************************************************************/
+
+#include "simple_robot_app_control.h"
+
+#include <string.h>
+#include <math.h>
+
+/*
+** The P loop is only stable for 0 < Kp < 2, and the fixed-point kernel's
+** Q2.30 gain cannot represent anything outside that range either.
+*/
+__extension__ _Static_assert(SIMPLE_ROBOT_APP_CONTROL_KP > 0.0 && SIMPLE_ROBOT_APP_CONTROL_KP < 2.0,
+                             "SIMPLE_ROBOT_APP_CONTROL_KP must be in (0, 2)");
+
+#ifdef SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL
+
+static int32 SimpleRobotAppToQ(float Rad)
+{
+    if (Rad > SIMPLE_ROBOT_APP_Q_LIMIT_RAD)
+    {
+        Rad = SIMPLE_ROBOT_APP_Q_LIMIT_RAD;
+    }
+    else if (Rad < -SIMPLE_ROBOT_APP_Q_LIMIT_RAD)
+    {
+        Rad = -SIMPLE_ROBOT_APP_Q_LIMIT_RAD;
+    }
+    return (int32)(Rad * (float)SIMPLE_ROBOT_APP_Q_ONE + (Rad >= 0.0f ? 0.5f : -0.5f));
+}
+
+static float SimpleRobotAppFromQ(int32 Q)
+{
+    return (float)Q * (1.0f / (float)SIMPLE_ROBOT_APP_Q_ONE);
+}
+
+void SimpleRobotAppControlInit(SimpleRobotAppControl_t *Ctl)
+{
+    memset(Ctl, 0, sizeof(*Ctl));
+}
+
+void SimpleRobotAppControlSetGoal(SimpleRobotAppControl_t *Ctl, const SimpleRobotAppJointConfig_t *Goal)
+{
+    Ctl->Goal[0] = SimpleRobotAppToQ(Goal->shoulder_pan_joint);
+    Ctl->Goal[1] = SimpleRobotAppToQ(Goal->shoulder_lift_joint);
+    Ctl->Goal[2] = SimpleRobotAppToQ(Goal->elbow_joint);
+    Ctl->Goal[3] = SimpleRobotAppToQ(Goal->wrist_1_joint);
+    Ctl->Goal[4] = SimpleRobotAppToQ(Goal->wrist_2_joint);
+    Ctl->Goal[5] = SimpleRobotAppToQ(Goal->wrist_3_joint);
+}
+
+void SimpleRobotAppControlSetTolerance(SimpleRobotAppControl_t *Ctl, float Tolerance)
+{
+    Ctl->Tolerance = SimpleRobotAppToQ(Tolerance);
+}
+
+/*
+** state += Kp * (goal - state) in Q8.24, with the Q2.30 gain product
+** rounded to nearest. Returns true once every joint is within tolerance.
+*/
+bool SimpleRobotAppControlStep(SimpleRobotAppControl_t *Ctl, const SimpleRobotAppJointConfig_t *Goal)
+{
+    int32 MaxErr = 0;
+    int32 Err;
+    int   i;
+
+    for (i = 0; i < SIMPLE_ROBOT_APP_NUM_JOINTS; i++)
+    {
+        Err = Ctl->Goal[i] - Ctl->State[i];
+        Ctl->State[i] += (int32)(((int64)Err * SIMPLE_ROBOT_APP_KP_Q + (1L << (SIMPLE_ROBOT_APP_KP_FRAC_BITS - 1))) >>
+                                 SIMPLE_ROBOT_APP_KP_FRAC_BITS);
+
+        Err = Ctl->Goal[i] - Ctl->State[i];
+        if (Err < 0)
+        {
+            Err = -Err;
+        }
+        if (Err > MaxErr)
+        {
+            MaxErr = Err;
+        }
+    }
+
+    return Ctl->Tolerance > 0 && MaxErr <= Ctl->Tolerance;
+}
+
+void SimpleRobotAppControlGetState(const SimpleRobotAppControl_t *Ctl, SimpleRobotAppJointConfig_t *State)
+{
+    State->shoulder_pan_joint  = SimpleRobotAppFromQ(Ctl->State[0]);
+    State->shoulder_lift_joint = SimpleRobotAppFromQ(Ctl->State[1]);
+    State->elbow_joint         = SimpleRobotAppFromQ(Ctl->State[2]);
+    State->wrist_1_joint       = SimpleRobotAppFromQ(Ctl->State[3]);
+    State->wrist_2_joint       = SimpleRobotAppFromQ(Ctl->State[4]);
+    State->wrist_3_joint       = SimpleRobotAppFromQ(Ctl->State[5]);
+}
+
+#else /* float kernel */
+
+void SimpleRobotAppControlInit(SimpleRobotAppControl_t *Ctl)
+{
+    memset(Ctl, 0, sizeof(*Ctl));
+}
+
+void SimpleRobotAppControlSetGoal(SimpleRobotAppControl_t *Ctl, const SimpleRobotAppJointConfig_t *Goal)
+{
+    /* The float kernel reads the goal directly */
+}
+
+void SimpleRobotAppControlSetTolerance(SimpleRobotAppControl_t *Ctl, float Tolerance)
+{
+    Ctl->Tolerance = Tolerance;
+}
+
+bool SimpleRobotAppControlStep(SimpleRobotAppControl_t *Ctl, const SimpleRobotAppJointConfig_t *Goal)
+{
+    SimpleRobotAppJointConfig_t *State = &Ctl->State;
+    const float                  Kp    = SIMPLE_ROBOT_APP_CONTROL_KP;
+    float                        errors[SIMPLE_ROBOT_APP_NUM_JOINTS];
+    float                        MaxErr;
+
+    errors[0] = Goal->shoulder_pan_joint - State->shoulder_pan_joint;
+    errors[1] = Goal->shoulder_lift_joint - State->shoulder_lift_joint;
+    errors[2] = Goal->elbow_joint - State->elbow_joint;
+    errors[3] = Goal->wrist_1_joint - State->wrist_1_joint;
+    errors[4] = Goal->wrist_2_joint - State->wrist_2_joint;
+    errors[5] = Goal->wrist_3_joint - State->wrist_3_joint;
+
+    State->shoulder_pan_joint += Kp * errors[0];
+    State->shoulder_lift_joint += Kp * errors[1];
+    State->elbow_joint += Kp * errors[2];
+    State->wrist_1_joint += Kp * errors[3];
+    State->wrist_2_joint += Kp * errors[4];
+    State->wrist_3_joint += Kp * errors[5];
+
+    MaxErr = fabsf(Goal->shoulder_pan_joint - State->shoulder_pan_joint);
+    MaxErr = fmaxf(MaxErr, fabsf(Goal->shoulder_lift_joint - State->shoulder_lift_joint));
+    MaxErr = fmaxf(MaxErr, fabsf(Goal->elbow_joint - State->elbow_joint));
+    MaxErr = fmaxf(MaxErr, fabsf(Goal->wrist_1_joint - State->wrist_1_joint));
+    MaxErr = fmaxf(MaxErr, fabsf(Goal->wrist_2_joint - State->wrist_2_joint));
+    MaxErr = fmaxf(MaxErr, fabsf(Goal->wrist_3_joint - State->wrist_3_joint));
+
+    return Ctl->Tolerance > 0.0f && MaxErr <= Ctl->Tolerance;
+}
+
+void SimpleRobotAppControlGetState(const SimpleRobotAppControl_t *Ctl, SimpleRobotAppJointConfig_t *State)
+{
+    *State = Ctl->State;
+}
+
+#endif /* SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL */
+
+/************************/
+/*  End of File Comment */
+/************************/
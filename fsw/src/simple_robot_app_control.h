@@ -0,0 +1,64 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_control.h
+**
+** Purpose:
+**  Joint controller kernel run on every HR tick.
+**
+** Notes:
+**  The kernel is chosen at build time. By default it is single-precision
+**  float. With SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL it keeps goal and state
+**  in Q8.24 and applies the gain SIMPLE_ROBOT_APP_CONTROL_KP as a Q2.30
+**  constant, for targets where float math is slow. Both are set from
+**  CMakeLists.txt.
+**
+**  The controller owns the joint state. Callers that need it in radians
+**  fetch it with SimpleRobotAppControlGetState, so the fixed-point kernel's
+**  per-tick path stays integer-only.
+**
+*******************************************************************************/
+#ifndef _simple_robot_app_control_h_
+#define _simple_robot_app_control_h_
+
+#include "cfe.h"
+#include "simple_robot_app_msg.h"
+
+#ifndef SIMPLE_ROBOT_APP_CONTROL_KP
+#define SIMPLE_ROBOT_APP_CONTROL_KP 0.01 /* Proportional gain per HR tick */
+#endif
+
+#define SIMPLE_ROBOT_APP_NUM_JOINTS 6
+
+#ifdef SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL
+#define SIMPLE_ROBOT_APP_Q_FRAC_BITS  24
+#define SIMPLE_ROBOT_APP_Q_ONE        (1L << SIMPLE_ROBOT_APP_Q_FRAC_BITS)
+#define SIMPLE_ROBOT_APP_KP_FRAC_BITS 30
+#define SIMPLE_ROBOT_APP_KP_Q         ((int32)(SIMPLE_ROBOT_APP_CONTROL_KP * (double)(1L << SIMPLE_ROBOT_APP_KP_FRAC_BITS) + 0.5))
+
+/* Goals are clamped here so goal - state always fits in an int32 */
+#define SIMPLE_ROBOT_APP_Q_LIMIT_RAD 60.0f
+#endif
+
+typedef struct
+{
+#ifdef SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL
+    int32 Goal[SIMPLE_ROBOT_APP_NUM_JOINTS];
+    int32 State[SIMPLE_ROBOT_APP_NUM_JOINTS];
+    int32 Tolerance;
+#else
+    SimpleRobotAppJointConfig_t State;
+    float                       Tolerance;
+#endif
+} SimpleRobotAppControl_t;
+
+void SimpleRobotAppControlInit(SimpleRobotAppControl_t *Ctl);
+void SimpleRobotAppControlSetGoal(SimpleRobotAppControl_t *Ctl, const SimpleRobotAppJointConfig_t *Goal);
+void SimpleRobotAppControlSetTolerance(SimpleRobotAppControl_t *Ctl, float Tolerance);
+bool SimpleRobotAppControlStep(SimpleRobotAppControl_t *Ctl, const SimpleRobotAppJointConfig_t *Goal);
+void SimpleRobotAppControlGetState(const SimpleRobotAppControl_t *Ctl, SimpleRobotAppJointConfig_t *State);
+
+#endif /* _simple_robot_app_control_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
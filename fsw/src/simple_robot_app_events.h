@@ -20,8 +20,13 @@
 #define SIMPLE_ROBOT_APP_INVALID_MSGID_ERR_EID 5
 #define SIMPLE_ROBOT_APP_LEN_ERR_EID           6
 #define SIMPLE_ROBOT_APP_PIPE_ERR_EID          7
+#define SIMPLE_ROBOT_APP_TABLE_ERR_EID         8
+#define SIMPLE_ROBOT_APP_SHM_ERR_EID           9
+#define SIMPLE_ROBOT_APP_GOAL_REACHED_INF_EID  10
+#define SIMPLE_ROBOT_APP_WORKER_ERR_EID        11
 
-#define SIMPLE_ROBOT_APP_EVENT_COUNTS 7
+/* Number of entries in the event filter table; keep <= CFE_PLATFORM_EVS_MAX_EVENT_FILTERS */
+#define SIMPLE_ROBOT_APP_EVENT_COUNTS 3
 
 #endif /* _simple_robot_app_events_h_ */
 
@@ -0,0 +1,91 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_latency.c
+**
+** Purpose:
+**   Rolling window statistics for command-to-motion latency.
+**
+*******************************************************************************/
+
+#include "simple_robot_app_latency.h"
+
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppLatencyUsec() -- Elapsed time, clamped to the uint32 range   */
+/*                                                                            */
+/* A negative span means the sender's clock is ahead of ours, report 0.       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 SimpleRobotAppLatencyUsec(OS_time_t Start, OS_time_t End)
+{
+    int64 Usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(End, Start));
+
+    if (Usec < 0)
+    {
+        return 0;
+    }
+    if (Usec > (int64)0xFFFFFFFF)
+    {
+        return 0xFFFFFFFF;
+    }
+    return (uint32)Usec;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppLatencyAdd() -- Record one sample, dropping the oldest       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppLatencyAdd(SimpleRobotAppLatencyWindow_t *Window, uint32 Usec)
+{
+    Window->Sample[Window->Next] = Usec;
+    Window->Next                 = (Window->Next + 1) % SIMPLE_ROBOT_APP_LATENCY_WINDOW;
+    if (Window->Count < SIMPLE_ROBOT_APP_LATENCY_WINDOW)
+    {
+        Window->Count++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppLatencyRollup() -- Summarize a window into telemetry         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppLatencyRollup(const SimpleRobotAppLatencyWindow_t *Window, SimpleRobotAppLatencyTlm_t *Tlm)
+{
+    uint64 Sum = 0;
+    uint32 i;
+
+    memset(Tlm, 0, sizeof(*Tlm));
+    if (Window->Count == 0)
+    {
+        return;
+    }
+
+    Tlm->sample_count = Window->Count;
+    Tlm->last_usec    = Window->Sample[(Window->Next + SIMPLE_ROBOT_APP_LATENCY_WINDOW - 1) % SIMPLE_ROBOT_APP_LATENCY_WINDOW];
+    Tlm->min_usec     = 0xFFFFFFFF;
+
+    /* Until the window fills, the valid samples are 0 .. Count-1 */
+    for (i = 0; i < Window->Count; i++)
+    {
+        uint32 Usec = Window->Sample[i];
+
+        Sum += Usec;
+        if (Usec < Tlm->min_usec)
+        {
+            Tlm->min_usec = Usec;
+        }
+        if (Usec > Tlm->max_usec)
+        {
+            Tlm->max_usec = Usec;
+        }
+    }
+    Tlm->mean_usec = (uint32)(Sum / Window->Count);
+}
+
+/************************/
+/*  End of File Comment */
+/************************/
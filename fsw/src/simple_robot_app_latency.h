@@ -0,0 +1,50 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_latency.h
+**
+** Purpose:
+**  Rolling command-to-motion latency statistics.
+**
+** Notes:
+**  The bridge stage compares the sender's stamp with OS_GetLocalTime, the
+**  host wall clock on Linux, so it is only meaningful when the sender shares
+**  that clock. The apply and converge stages are measured inside the app
+**  with CFE_PSP_GetTime and are not affected by wall clock steps.
+**
+*******************************************************************************/
+#ifndef _simple_robot_app_latency_h_
+#define _simple_robot_app_latency_h_
+
+#include "cfe.h"
+#include "simple_robot_app_msg.h"
+
+#define SIMPLE_ROBOT_APP_LATENCY_WINDOW 16 /* Samples kept per stage */
+
+typedef struct
+{
+    uint32 Sample[SIMPLE_ROBOT_APP_LATENCY_WINDOW];
+    uint32 Next;
+    uint32 Count;
+} SimpleRobotAppLatencyWindow_t;
+
+/*
+** Timing of the goal currently being executed
+*/
+typedef struct
+{
+    OS_time_t Received; /* CFE_PSP_GetTime, not wall clock */
+    OS_time_t Applied;
+    bool      PendingApply; /* Received but no control tick has run on it yet */
+
+    SimpleRobotAppLatencyWindow_t Stage[SIMPLE_ROBOT_APP_LATENCY_STAGES];
+} SimpleRobotAppLatency_t;
+
+uint32 SimpleRobotAppLatencyUsec(OS_time_t Start, OS_time_t End);
+void   SimpleRobotAppLatencyAdd(SimpleRobotAppLatencyWindow_t *Window, uint32 Usec);
+void   SimpleRobotAppLatencyRollup(const SimpleRobotAppLatencyWindow_t *Window, SimpleRobotAppLatencyTlm_t *Tlm);
+
+#endif /* _simple_robot_app_latency_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -31,11 +31,29 @@
 #ifndef _simple_robot_app_msg_h_
 #define _simple_robot_app_msg_h_
 
+#include "simple_robot_app_table.h"
+
+/**
+ * SimpleRobotApp ground command set
+ *
+ * X(Name, Type, Handler) per command, in command code order starting at 0.
+ * Command codes, the dispatch table, length checks and per-command stats
+ * are all generated from this list, so only append to it.
+ */
+#define SIMPLE_ROBOT_APP_COMMAND_LIST(X)                    \
+    X(NOOP, SimpleRobotAppNoopCmd_t, SimpleRobotAppNoop) \
+    X(CMD, SimpleRobotAppCmd_t, updateRobotCommand)
+
 /**
  * SimpleRobotApp command codes
  */
-#define SIMPLE_ROBOT_APP_NOOP_CC        0
-#define SIMPLE_ROBOT_APP_CMD_CC   1
+#define SIMPLE_ROBOT_APP_CC_ENUM(Name, Type, Handler) SIMPLE_ROBOT_APP_##Name##_CC,
+enum
+{
+    SIMPLE_ROBOT_APP_COMMAND_LIST(SIMPLE_ROBOT_APP_CC_ENUM)
+    SIMPLE_ROBOT_APP_NUM_COMMANDS
+};
+#undef SIMPLE_ROBOT_APP_CC_ENUM
 
 /*************************************************************************/
 
@@ -62,6 +80,9 @@ typedef struct
 {
    CFE_MSG_CommandHeader_t CmdHeader;
    SimpleRobotAppJointConfig_t joint_goal;
+   uint32 goal_seq;   /**< \brief Sender's goal sequence number, echoed in telemetry */
+   uint32 stamp_sec;  /**< \brief Source (wall clock) time the goal was sent, 0 if unknown */
+   uint32 stamp_nsec;
 } SimpleRobotAppCmd_t;
 
 /*
@@ -73,12 +94,64 @@ typedef struct
 */
 typedef SimpleRobotAppNoArgsCmd_t SimpleRobotAppNoopCmd_t;
 
+/*
+** Any ground command, as seen by the dispatcher
+*/
+typedef union
+{
+    CFE_SB_Buffer_t SBBuf;
+#define SIMPLE_ROBOT_APP_CMD_MEMBER(Name, Type, Handler) Type Name;
+    SIMPLE_ROBOT_APP_COMMAND_LIST(SIMPLE_ROBOT_APP_CMD_MEMBER)
+#undef SIMPLE_ROBOT_APP_CMD_MEMBER
+} SimpleRobotAppCmdBuffer_t;
+
 /*************************************************************************/
 
+/**
+ * Goal latency stages, indexes of SimpleRobotAppTlm_t.latency
+ */
+#define SIMPLE_ROBOT_APP_LATENCY_BRIDGE   0 /**< \brief Source stamp to command receipt */
+#define SIMPLE_ROBOT_APP_LATENCY_APPLY    1 /**< \brief Command receipt to first control tick on the goal */
+#define SIMPLE_ROBOT_APP_LATENCY_CONVERGE 2 /**< \brief First control tick to goal reached */
+#define SIMPLE_ROBOT_APP_LATENCY_STAGES   3
+
+typedef struct
+{
+    uint32 sample_count; /**< \brief Samples in the rolling window */
+    uint32 last_usec;
+    uint32 min_usec;
+    uint32 mean_usec;
+    uint32 max_usec;
+} SimpleRobotAppLatencyTlm_t;
+
+typedef struct
+{
+    uint32 invoke_count; /**< \brief Commands that passed the length check and ran */
+    uint32 total_usec;   /**< \brief Cumulative handler time */
+} SimpleRobotAppCmdStatsTlm_t;
+
+typedef struct
+{
+    uint32 run_count;     /**< \brief Times the group has run */
+    uint32 overrun_count; /**< \brief Runs that exceeded the group budget */
+    uint32 last_usec;     /**< \brief Duration of the latest run */
+    uint32 max_usec;      /**< \brief Longest run since the group was configured */
+} SimpleRobotAppRateGroupTlm_t;
+
 typedef struct
 {
     CFE_MSG_TelemetryHeader_t  TlmHeader; /**< \brief Telemetry header */
     SimpleRobotAppJointConfig_t joint_state;   /**< \brief Telemetry payload */
+    uint32 tlm_sent_count;       /**< \brief Joint packets sent (including this one) */
+    uint32 tlm_suppressed_count; /**< \brief HK requests answered by the deadband without a send */
+    uint8  goal_reached;         /**< \brief 1 once the state is within ConvergeTolerance of the goal */
+    uint8  spare[3];
+    uint32 last_goal_seq;        /**< \brief goal_seq of the latest goal received */
+    uint32 goal_dropped_count;   /**< \brief Goals lost because a preprocessing queue was full */
+    uint32 goal_limited_count;   /**< \brief Goals clamped to JointPositionLimit */
+    SimpleRobotAppLatencyTlm_t latency[SIMPLE_ROBOT_APP_LATENCY_STAGES];
+    SimpleRobotAppCmdStatsTlm_t cmd_stats[SIMPLE_ROBOT_APP_NUM_COMMANDS]; /**< \brief Indexed by command code */
+    SimpleRobotAppRateGroupTlm_t rate_group[SIMPLE_ROBOT_APP_MAX_RATE_GROUPS];
 } SimpleRobotAppTlm_t;
 
 
@@ -0,0 +1,160 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_sched.c
+**
+** Purpose:
+**   Rate-group scheduler run from the HR control wakeup.
+**
+*******************************************************************************/
+
+#include "simple_robot_app_events.h"
+#include "simple_robot_app.h"
+#include "cfe_psp.h"
+
+#include <string.h>
+
+/*
+** Task functions, indexed by SIMPLE_ROBOT_APP_TASK_xxx
+*/
+static const SimpleRobotAppTaskFunc_t SimpleRobotAppTaskTable[SIMPLE_ROBOT_APP_TASK_COUNT] = {
+    NULL,                         /* SIMPLE_ROBOT_APP_TASK_NONE */
+    SimpleRobotAppTlmMotionTask,  /* SIMPLE_ROBOT_APP_TASK_TLM_MOTION */
+    SimpleRobotAppDiagRollupTask  /* SIMPLE_ROBOT_APP_TASK_DIAG_ROLLUP */
+};
+
+static uint16 SimpleRobotAppGcd(uint16 a, uint16 b)
+{
+    while (b != 0)
+    {
+        uint16 t = a % b;
+        a        = b;
+        b        = t;
+    }
+    return a;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppSchedConfigure() -- Load rate groups and assign phases       */
+/*                                                                            */
+/* Two groups with divisors Da, Db and phases Pa, Pb are due on the same      */
+/* tick iff Pa == Pb (mod gcd(Da, Db)). Each group takes the first phase that */
+/* avoids all groups placed before it.                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppSchedConfigure(SimpleRobotAppSched_t *Sched, const SimpleRobotAppRateGroupConfig_t *Config)
+{
+    uint16 g;
+    uint16 h;
+    uint16 Phase;
+    bool   Clash;
+
+    memset(Sched->Group, 0, sizeof(Sched->Group));
+    Sched->PhaseConflicts = 0;
+
+    for (g = 0; g < SIMPLE_ROBOT_APP_MAX_RATE_GROUPS; g++)
+    {
+        SimpleRobotAppRateGroup_t *Group = &Sched->Group[g];
+
+        Group->Divisor    = Config[g].Divisor;
+        Group->BudgetUsec = Config[g].BudgetUsec;
+        memcpy(Group->TaskId, Config[g].TaskId, sizeof(Group->TaskId));
+
+        if (Group->Divisor == 0)
+        {
+            continue;
+        }
+
+        Clash = true;
+        for (Phase = 0; Phase < Group->Divisor && Clash; Phase++)
+        {
+            Clash = false;
+            for (h = 0; h < g && !Clash; h++)
+            {
+                const SimpleRobotAppRateGroup_t *Other = &Sched->Group[h];
+                uint16                           Gcd;
+
+                if (Other->Divisor == 0)
+                {
+                    continue;
+                }
+                Gcd   = SimpleRobotAppGcd(Group->Divisor, Other->Divisor);
+                Clash = (Phase % Gcd) == (Other->Phase % Gcd);
+            }
+        }
+
+        if (Clash)
+        {
+            /* Divisors leave no free tick, share one with an earlier group */
+            Sched->PhaseConflicts++;
+            Phase = g % Group->Divisor;
+        }
+        else
+        {
+            Phase--; /* Undo the loop increment past the free phase */
+        }
+
+        Group->Phase = Phase;
+        /* Line the countdown up with the running tick counter */
+        Group->Countdown = (uint16)((Phase + Group->Divisor - (Sched->TickCount % Group->Divisor)) % Group->Divisor);
+    }
+
+} /* End of SimpleRobotAppSchedConfigure() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppSchedTick() -- Run every rate group due on this HR tick      */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppSchedTick(SimpleRobotAppSched_t *Sched)
+{
+    uint16    g;
+    uint16    t;
+    OS_time_t Start;
+    OS_time_t End;
+    uint32    Usec;
+
+    for (g = 0; g < SIMPLE_ROBOT_APP_MAX_RATE_GROUPS; g++)
+    {
+        SimpleRobotAppRateGroup_t *Group = &Sched->Group[g];
+
+        if (Group->Divisor == 0)
+        {
+            continue;
+        }
+
+        if (Group->Countdown > 0)
+        {
+            Group->Countdown--;
+            continue;
+        }
+        Group->Countdown = Group->Divisor - 1;
+
+        CFE_PSP_GetTime(&Start);
+        for (t = 0; t < SIMPLE_ROBOT_APP_MAX_GROUP_TASKS && Group->TaskId[t] != SIMPLE_ROBOT_APP_TASK_NONE; t++)
+        {
+            SimpleRobotAppTaskTable[Group->TaskId[t]]();
+        }
+        CFE_PSP_GetTime(&End);
+
+        Usec = (uint32)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(End, Start));
+
+        Group->RunCount++;
+        Group->LastUsec = Usec;
+        if (Usec > Group->MaxUsec)
+        {
+            Group->MaxUsec = Usec;
+        }
+        if (Group->BudgetUsec > 0 && Usec > Group->BudgetUsec)
+        {
+            Group->OverrunCount++;
+        }
+    }
+
+    Sched->TickCount++;
+
+} /* End of SimpleRobotAppSchedTick() */
+
+/************************/
+/*  End of File Comment */
+/************************/
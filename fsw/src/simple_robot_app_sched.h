@@ -0,0 +1,50 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_sched.h
+**
+** Purpose:
+**  Static rate-group scheduler driven by the HR control wakeup.
+**
+** Notes:
+**  Each rate group runs its tasks every Divisor HR ticks. Group phases are
+**  chosen so that no two groups are due on the same tick whenever the
+**  divisors allow it.
+**
+*******************************************************************************/
+#ifndef _simple_robot_app_sched_h_
+#define _simple_robot_app_sched_h_
+
+#include "cfe.h"
+#include "simple_robot_app_table.h"
+
+typedef void (*SimpleRobotAppTaskFunc_t)(void);
+
+typedef struct
+{
+    uint16 Divisor;
+    uint16 Phase;
+    uint16 Countdown; /* Ticks left until the next run */
+    uint16 BudgetUsec;
+    uint8  TaskId[SIMPLE_ROBOT_APP_MAX_GROUP_TASKS];
+
+    uint32 RunCount;
+    uint32 OverrunCount;
+    uint32 LastUsec;
+    uint32 MaxUsec;
+} SimpleRobotAppRateGroup_t;
+
+typedef struct
+{
+    uint32 TickCount;
+    uint32 PhaseConflicts; /* Groups that could not get a tick of their own */
+    SimpleRobotAppRateGroup_t Group[SIMPLE_ROBOT_APP_MAX_RATE_GROUPS];
+} SimpleRobotAppSched_t;
+
+void SimpleRobotAppSchedConfigure(SimpleRobotAppSched_t *Sched, const SimpleRobotAppRateGroupConfig_t *Config);
+void SimpleRobotAppSchedTick(SimpleRobotAppSched_t *Sched);
+
+#endif /* _simple_robot_app_sched_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,135 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_shm.c
+**
+** Purpose:
+**   Writer side of the shared-memory joint state segment. Only built when
+**   SIMPLE_ROBOT_APP_SHM_STATE is enabled in CMake.
+**
+*******************************************************************************/
+
+/* shm_open, ftruncate and mmap are POSIX, not ISO C: expose them under -std=c99 */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "cfe.h"
+#include "simple_robot_app_events.h"
+#include "simple_robot_app_shm_writer.h"
+#include "simple_robot_app_shm.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static SimpleRobotAppShmSegment_t *SimpleRobotAppShmSeg = NULL;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppShmOpen() -- Create and map the state segment                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 SimpleRobotAppShmOpen(void)
+{
+    void *Addr;
+    int   Fd;
+
+    Fd = shm_open(SIMPLE_ROBOT_APP_SHM_NAME, O_CREAT | O_RDWR, 0644);
+    if (Fd < 0)
+    {
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: shm_open %s failed, errno = %d", SIMPLE_ROBOT_APP_SHM_NAME, errno);
+        return SIMPLE_ROBOT_APP_SHM_ERR_CODE;
+    }
+
+    if (ftruncate(Fd, sizeof(SimpleRobotAppShmSegment_t)) != 0)
+    {
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: ftruncate %s failed, errno = %d", SIMPLE_ROBOT_APP_SHM_NAME, errno);
+        close(Fd);
+        return SIMPLE_ROBOT_APP_SHM_ERR_CODE;
+    }
+
+    Addr = mmap(NULL, sizeof(SimpleRobotAppShmSegment_t), PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+    close(Fd);
+    if (Addr == MAP_FAILED)
+    {
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: mmap %s failed, errno = %d", SIMPLE_ROBOT_APP_SHM_NAME, errno);
+        return SIMPLE_ROBOT_APP_SHM_ERR_CODE;
+    }
+
+    SimpleRobotAppShmSeg = Addr;
+
+    /* Publish the layout last so readers never accept a half-built header */
+    memset(&SimpleRobotAppShmSeg->Data, 0, sizeof(SimpleRobotAppShmSeg->Data));
+    __atomic_store_n(&SimpleRobotAppShmSeg->Seq, 0, __ATOMIC_RELAXED);
+    SimpleRobotAppShmSeg->Version = SIMPLE_ROBOT_APP_SHM_VERSION;
+    __atomic_store_n(&SimpleRobotAppShmSeg->Magic, SIMPLE_ROBOT_APP_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    return CFE_SUCCESS;
+
+} /* End of SimpleRobotAppShmOpen() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppShmPublish() -- Write one snapshot under the seqlock         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppShmPublish(uint32 Tick, const SimpleRobotAppJointConfig_t *Goal,
+                              const SimpleRobotAppJointConfig_t *State)
+{
+    SimpleRobotAppShmState_t *Data;
+    uint32                    Seq;
+
+    if (SimpleRobotAppShmSeg == NULL)
+    {
+        return;
+    }
+
+    Data = &SimpleRobotAppShmSeg->Data;
+    Seq  = SimpleRobotAppShmSeg->Seq;
+
+    __atomic_store_n(&SimpleRobotAppShmSeg->Seq, Seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    Data->tick     = Tick;
+    Data->goal[0]  = Goal->shoulder_pan_joint;
+    Data->goal[1]  = Goal->shoulder_lift_joint;
+    Data->goal[2]  = Goal->elbow_joint;
+    Data->goal[3]  = Goal->wrist_1_joint;
+    Data->goal[4]  = Goal->wrist_2_joint;
+    Data->goal[5]  = Goal->wrist_3_joint;
+    Data->state[0] = State->shoulder_pan_joint;
+    Data->state[1] = State->shoulder_lift_joint;
+    Data->state[2] = State->elbow_joint;
+    Data->state[3] = State->wrist_1_joint;
+    Data->state[4] = State->wrist_2_joint;
+    Data->state[5] = State->wrist_3_joint;
+
+    __atomic_store_n(&SimpleRobotAppShmSeg->Seq, Seq + 2, __ATOMIC_RELEASE);
+
+} /* End of SimpleRobotAppShmPublish() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppShmClose() -- Unmap and remove the segment                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppShmClose(void)
+{
+    if (SimpleRobotAppShmSeg == NULL)
+    {
+        return;
+    }
+
+    /* Readers that are still attached keep their mapping until they detach */
+    munmap(SimpleRobotAppShmSeg, sizeof(SimpleRobotAppShmSegment_t));
+    shm_unlink(SIMPLE_ROBOT_APP_SHM_NAME);
+    SimpleRobotAppShmSeg = NULL;
+
+} /* End of SimpleRobotAppShmClose() */
+
+/************************/
+/*  End of File Comment */
+/************************/
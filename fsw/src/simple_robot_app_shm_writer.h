@@ -0,0 +1,30 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_shm_writer.h
+**
+** Purpose:
+**  Writer side of the optional shared-memory joint state segment.
+**
+** Notes:
+**  Kept apart from simple_robot_app.h so the writer only depends on the
+**  message types and can be built on the host for benchmarking.
+**
+*******************************************************************************/
+#ifndef _simple_robot_app_shm_writer_h_
+#define _simple_robot_app_shm_writer_h_
+
+#include "cfe.h"
+#include "simple_robot_app_msg.h"
+
+#define SIMPLE_ROBOT_APP_SHM_ERR_CODE -2
+
+int32 SimpleRobotAppShmOpen(void);
+void  SimpleRobotAppShmPublish(uint32 Tick, const SimpleRobotAppJointConfig_t *Goal,
+                               const SimpleRobotAppJointConfig_t *State);
+void  SimpleRobotAppShmClose(void);
+
+#endif /* _simple_robot_app_shm_writer_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,63 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_spsc.c
+**
+** Purpose:
+**   Lock-free single-producer / single-consumer queue.
+**
+*******************************************************************************/
+
+#include "simple_robot_app_spsc.h"
+
+#include <string.h>
+
+void SimpleRobotAppSpscInit(SimpleRobotAppSpsc_t *Queue, void *Storage, size_t ElemSize, uint32 Depth)
+{
+    Queue->Head     = 0;
+    Queue->Tail     = 0;
+    Queue->Depth    = Depth;
+    Queue->ElemSize = ElemSize;
+    Queue->Storage  = Storage;
+}
+
+/*
+** Producer side. Returns false without blocking if the queue is full.
+*/
+bool SimpleRobotAppSpscPush(SimpleRobotAppSpsc_t *Queue, const void *Item)
+{
+    uint32 Tail = __atomic_load_n(&Queue->Tail, __ATOMIC_RELAXED);
+    uint32 Head = __atomic_load_n(&Queue->Head, __ATOMIC_ACQUIRE);
+
+    if (Tail - Head >= Queue->Depth)
+    {
+        return false;
+    }
+
+    memcpy(&Queue->Storage[(Tail & (Queue->Depth - 1)) * Queue->ElemSize], Item, Queue->ElemSize);
+    __atomic_store_n(&Queue->Tail, Tail + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/*
+** Consumer side. Returns false without blocking if the queue is empty.
+*/
+bool SimpleRobotAppSpscPop(SimpleRobotAppSpsc_t *Queue, void *Item)
+{
+    uint32 Head = __atomic_load_n(&Queue->Head, __ATOMIC_RELAXED);
+    uint32 Tail = __atomic_load_n(&Queue->Tail, __ATOMIC_ACQUIRE);
+
+    if (Head == Tail)
+    {
+        return false;
+    }
+
+    memcpy(Item, &Queue->Storage[(Head & (Queue->Depth - 1)) * Queue->ElemSize], Queue->ElemSize);
+    __atomic_store_n(&Queue->Head, Head + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,35 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_spsc.h
+**
+** Purpose:
+**  Lock-free single-producer / single-consumer queue of fixed-size items.
+**
+** Notes:
+**  Head is only written by the consumer and Tail only by the producer, so
+**  neither side ever waits on the other. Depth must be a power of two.
+**
+*******************************************************************************/
+#ifndef _simple_robot_app_spsc_h_
+#define _simple_robot_app_spsc_h_
+
+#include "cfe.h"
+
+typedef struct
+{
+    uint32 Head; /* Items popped, free running */
+    uint32 Tail; /* Items pushed, free running */
+    uint32 Depth;
+    size_t ElemSize;
+    uint8 *Storage;
+} SimpleRobotAppSpsc_t;
+
+void SimpleRobotAppSpscInit(SimpleRobotAppSpsc_t *Queue, void *Storage, size_t ElemSize, uint32 Depth);
+bool SimpleRobotAppSpscPush(SimpleRobotAppSpsc_t *Queue, const void *Item);
+bool SimpleRobotAppSpscPop(SimpleRobotAppSpsc_t *Queue, void *Item);
+
+#endif /* _simple_robot_app_spsc_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
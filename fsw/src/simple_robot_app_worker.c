@@ -0,0 +1,162 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_worker.c
+**
+** Purpose:
+**   Child task that preprocesses incoming goals off the control path.
+**
+*******************************************************************************/
+
+#include "simple_robot_app_events.h"
+#include "simple_robot_app.h"
+#include "simple_robot_app_worker.h"
+
+/* Clamp one joint to +/- Limit, returns true if it was out of range */
+static bool SimpleRobotAppClampJoint(float *Joint, float Limit)
+{
+    if (*Joint > Limit)
+    {
+        *Joint = Limit;
+        return true;
+    }
+    if (*Joint < -Limit)
+    {
+        *Joint = -Limit;
+        return true;
+    }
+    return false;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppWorkerPreprocess() -- Turn a raw goal into a ready segment   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void SimpleRobotAppWorkerPreprocess(SimpleRobotAppSegment_t *Segment)
+{
+    float Limit   = Segment->PositionLimit;
+    bool  Limited = false;
+
+    if (Limit > 0.0f)
+    {
+        Limited |= SimpleRobotAppClampJoint(&Segment->Goal.shoulder_pan_joint, Limit);
+        Limited |= SimpleRobotAppClampJoint(&Segment->Goal.shoulder_lift_joint, Limit);
+        Limited |= SimpleRobotAppClampJoint(&Segment->Goal.elbow_joint, Limit);
+        Limited |= SimpleRobotAppClampJoint(&Segment->Goal.wrist_1_joint, Limit);
+        Limited |= SimpleRobotAppClampJoint(&Segment->Goal.wrist_2_joint, Limit);
+        Limited |= SimpleRobotAppClampJoint(&Segment->Goal.wrist_3_joint, Limit);
+    }
+
+    if (Limited)
+    {
+        SimpleRobotAppData.Worker.LimitedCount++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppWorkerInit() -- Create the queues and the child task         */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 SimpleRobotAppWorkerInit(void)
+{
+    SimpleRobotAppWorker_t *Worker = &SimpleRobotAppData.Worker;
+    int32                   status;
+
+    SimpleRobotAppSpscInit(&Worker->RequestQueue, Worker->RequestBuf, sizeof(SimpleRobotAppSegment_t),
+                           SIMPLE_ROBOT_APP_GOAL_QUEUE_DEPTH);
+    SimpleRobotAppSpscInit(&Worker->ReadyQueue, Worker->ReadyBuf, sizeof(SimpleRobotAppSegment_t),
+                           SIMPLE_ROBOT_APP_GOAL_QUEUE_DEPTH);
+    Worker->RequestDropCount = 0;
+    Worker->ReadyDropCount   = 0;
+    Worker->LimitedCount     = 0;
+
+    status = OS_CountSemCreate(&Worker->WakeSem, SIMPLE_ROBOT_APP_WORKER_SEM_NAME, 0, 0);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SimpleRobotApp: Error creating worker semaphore, RC = 0x%08lX\n", (unsigned long)status);
+        return (status);
+    }
+
+    status = CFE_ES_CreateChildTask(&Worker->TaskId, SIMPLE_ROBOT_APP_WORKER_NAME, SimpleRobotAppWorkerMain,
+                                    CFE_ES_TASK_STACK_ALLOCATE, SIMPLE_ROBOT_APP_WORKER_STACK_SIZE,
+                                    SIMPLE_ROBOT_APP_WORKER_PRIORITY, 0);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SimpleRobotApp: Error creating worker task, RC = 0x%08lX\n", (unsigned long)status);
+        return (status);
+    }
+
+    return (CFE_SUCCESS);
+
+} /* End of SimpleRobotAppWorkerInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppWorkerMain() -- Child task entry point                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SimpleRobotAppWorkerMain(void)
+{
+    SimpleRobotAppWorker_t *Worker = &SimpleRobotAppData.Worker;
+    SimpleRobotAppSegment_t Segment;
+
+    while (SimpleRobotAppData.RunStatus == CFE_ES_RunStatus_APP_RUN)
+    {
+        /* Timeouts only bring us back round to check the run status */
+        OS_CountSemTimedWait(Worker->WakeSem, SIMPLE_ROBOT_APP_WORKER_WAIT_MSEC);
+
+        while (SimpleRobotAppSpscPop(&Worker->RequestQueue, &Segment))
+        {
+            SimpleRobotAppWorkerPreprocess(&Segment);
+
+            if (!SimpleRobotAppSpscPush(&Worker->ReadyQueue, &Segment))
+            {
+                Worker->ReadyDropCount++;
+                CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "SimpleRobotApp: Ready goal queue full, goal dropped");
+            }
+        }
+    }
+
+} /* End of SimpleRobotAppWorkerMain() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppWorkerSubmit() -- Queue a raw goal, called by the command    */
+/*                                 handler. Never blocks.                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool SimpleRobotAppWorkerSubmit(const SimpleRobotAppSegment_t *Request)
+{
+    SimpleRobotAppWorker_t *Worker = &SimpleRobotAppData.Worker;
+
+    if (!SimpleRobotAppSpscPush(&Worker->RequestQueue, Request))
+    {
+        Worker->RequestDropCount++;
+        CFE_EVS_SendEvent(SIMPLE_ROBOT_APP_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SimpleRobotApp: Goal request queue full, goal dropped");
+        return false;
+    }
+
+    OS_CountSemGive(Worker->WakeSem);
+
+    return true;
+
+} /* End of SimpleRobotAppWorkerSubmit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* SimpleRobotAppWorkerNextSegment() -- Take the next ready segment, called   */
+/*                                      by the control loop. Never blocks.    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+bool SimpleRobotAppWorkerNextSegment(SimpleRobotAppSegment_t *Segment)
+{
+    return SimpleRobotAppSpscPop(&SimpleRobotAppData.Worker.ReadyQueue, Segment);
+
+} /* End of SimpleRobotAppWorkerNextSegment() */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,65 @@
+/*******************************************************************************
+**
+** File: simple_robot_app_worker.h
+**
+** Purpose:
+**  Background goal preprocessing worker.
+**
+** Notes:
+**  The command handler queues raw goals for a low-priority child task,
+**  which checks them against the table limits and queues ready segments
+**  for the control loop. Both hand-offs are lock-free SPSC queues, so
+**  goal processing never blocks the HR tick. The worker never reads the
+**  app config: anything it needs travels in the segment.
+**
+*******************************************************************************/
+#ifndef _simple_robot_app_worker_h_
+#define _simple_robot_app_worker_h_
+
+#include "cfe.h"
+#include "simple_robot_app_msg.h"
+#include "simple_robot_app_spsc.h"
+
+#define SIMPLE_ROBOT_APP_GOAL_QUEUE_DEPTH  8 /* Power of two */
+#define SIMPLE_ROBOT_APP_WORKER_NAME       "SIMPLE_ROBOT_WORKER"
+#define SIMPLE_ROBOT_APP_WORKER_SEM_NAME   "SRA_WORKER_SEM"
+#define SIMPLE_ROBOT_APP_WORKER_PRIORITY   150 /* Below the app main task */
+#define SIMPLE_ROBOT_APP_WORKER_STACK_SIZE 8192
+#define SIMPLE_ROBOT_APP_WORKER_WAIT_MSEC  1000 /* Run status poll interval when idle */
+
+/*
+** One goal: raw on the request queue, limit-checked on the ready queue
+*/
+typedef struct
+{
+    SimpleRobotAppJointConfig_t Goal;
+    OS_time_t                   Received; /* CFE_PSP_GetTime at command receipt */
+    float                       PositionLimit; /* JointPositionLimit when the goal was received */
+} SimpleRobotAppSegment_t;
+
+typedef struct
+{
+    CFE_ES_TaskId_t TaskId;
+    osal_id_t       WakeSem;
+
+    SimpleRobotAppSpsc_t    RequestQueue; /* Command handler -> worker */
+    SimpleRobotAppSpsc_t    ReadyQueue;   /* Worker -> control loop */
+    SimpleRobotAppSegment_t RequestBuf[SIMPLE_ROBOT_APP_GOAL_QUEUE_DEPTH];
+    SimpleRobotAppSegment_t ReadyBuf[SIMPLE_ROBOT_APP_GOAL_QUEUE_DEPTH];
+
+    /* Each counter has a single writer */
+    uint32 RequestDropCount; /* Command handler */
+    uint32 ReadyDropCount;   /* Worker */
+    uint32 LimitedCount;     /* Worker */
+} SimpleRobotAppWorker_t;
+
+int32 SimpleRobotAppWorkerInit(void);
+void  SimpleRobotAppWorkerMain(void);
+bool  SimpleRobotAppWorkerSubmit(const SimpleRobotAppSegment_t *Request);
+bool  SimpleRobotAppWorkerNextSegment(SimpleRobotAppSegment_t *Segment);
+
+#endif /* _simple_robot_app_worker_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -6,8 +6,19 @@
 #include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
 #include "simple_robot_app_table.h"
 
-// Example
-SimpleRobotAppTable_t SimpleRobotAppTable = {1,2};
+SimpleRobotAppTable_t SimpleRobotAppTable = {
+    0.001, /* TlmDeadband: 1 mrad */
+    10,    /* TlmMaxIntervalHk: send at least every 10 HK requests */
+    1e-4,  /* ConvergeTolerance: 0.1 mrad, above the float P-loop stall point for joints up to 2 pi */
+    6.2832, /* JointPositionLimit: +/- 2 pi */
+    {
+        /* Divisors are in 1 kHz HR wakeups */
+        {100, 200, {SIMPLE_ROBOT_APP_TASK_TLM_MOTION}},  /* 10 Hz */
+        {1000, 100, {SIMPLE_ROBOT_APP_TASK_DIAG_ROLLUP}}, /* 1 Hz */
+        {0, 0, {SIMPLE_ROBOT_APP_TASK_NONE}},
+        {0, 0, {SIMPLE_ROBOT_APP_TASK_NONE}}
+    }
+};
 
 
 /*
@@ -17,4 +28,4 @@ SimpleRobotAppTable_t SimpleRobotAppTable = {1,2};
 **    3) a brief description of the contents of the file image
 **    4) the desired name of the table image binary file that is cFE compatible
 */
-CFE_TBL_FILEDEF(SimpleRobotAppTable, SimpleRobotApp.SimpleRobotAppTable, Table Utility Test Table, simple_robot_app_tbl.tbl)
+CFE_TBL_FILEDEF(SimpleRobotAppTable, SIMPLE_ROBOT_APP.SimpleRobotAppTable, Simple Robot App Config Table, simple_robot_app_tbl.tbl)
@@ -0,0 +1,99 @@
+/*******************************************************************************
+**
+** File: control_bench.c
+**
+** Purpose:
+**   Cost per HR tick of the joint controller kernel.
+**
+** Notes:
+**   Built once per kernel; run the control_bench target to compare them.
+**   Cycles are TSC cycles on x86 and are omitted elsewhere. Run on the
+**   target processor for numbers that matter: on a host with an FPU the
+**   float kernel is expected to be as fast or faster.
+**
+*******************************************************************************/
+
+/* clock_gettime is POSIX, not ISO C */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "simple_robot_app_control.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#ifdef SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL
+#define KERNEL_NAME "fixed"
+#else
+#define KERNEL_NAME "float"
+#endif
+
+#define BENCH_TICKS    2000000
+#define RETARGET_TICKS 500 /* New goal before convergence, so every tick does full work */
+
+static uint64 NowNsec(void)
+{
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (uint64)Ts.tv_sec * 1000000000u + (uint64)Ts.tv_nsec;
+}
+
+int main(void)
+{
+    static const SimpleRobotAppJointConfig_t Goals[2] = {
+        {1.5f, -3.1f, 6.2f, -6.2f, 0.001f, 2.0f},
+        {-0.7f, 0.0f, 3.14159f, 1.0f, -2.5f, 0.25f},
+    };
+    SimpleRobotAppControl_t     Ctl;
+    SimpleRobotAppJointConfig_t State;
+    volatile uint32             Sink  = 0;
+    uint64                      Start;
+    uint64                      End;
+    uint32                      Tick;
+    int                         g = 0;
+#if defined(__x86_64__) || defined(__i386__)
+    uint64 StartCycles;
+    uint64 EndCycles;
+#endif
+
+    SimpleRobotAppControlInit(&Ctl);
+    SimpleRobotAppControlSetTolerance(&Ctl, 1e-4f);
+    SimpleRobotAppControlSetGoal(&Ctl, &Goals[g]);
+
+    Start = NowNsec();
+#if defined(__x86_64__) || defined(__i386__)
+    StartCycles = __builtin_ia32_rdtsc();
+#endif
+
+    for (Tick = 0; Tick < BENCH_TICKS; Tick++)
+    {
+        if (Tick % RETARGET_TICKS == 0)
+        {
+            g ^= 1;
+            SimpleRobotAppControlSetGoal(&Ctl, &Goals[g]);
+        }
+        Sink += SimpleRobotAppControlStep(&Ctl, &Goals[g]);
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    EndCycles = __builtin_ia32_rdtsc();
+#endif
+    End = NowNsec();
+
+    SimpleRobotAppControlGetState(&Ctl, &State);
+
+    printf("%s kernel: %.1f ns/tick", KERNEL_NAME, (double)(End - Start) / BENCH_TICKS);
+#if defined(__x86_64__) || defined(__i386__)
+    printf(", %.1f cycles/tick", (double)(EndCycles - StartCycles) / BENCH_TICKS);
+#endif
+    printf(" (%u ticks, %u converged, final pan %f)\n", (unsigned int)BENCH_TICKS, (unsigned int)Sink,
+           (double)State.shoulder_pan_joint);
+
+    return 0;
+}
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,322 @@
+/*******************************************************************************
+**
+** File: control_test.c
+**
+** Purpose:
+**   Host test of the joint controller kernel against a float reference.
+**
+** Notes:
+**   Built once per kernel. The float kernel must match the reference
+**   exactly; the fixed-point kernel must track it to within a few Q8.24
+**   LSBs of accumulated rounding.
+**
+*******************************************************************************/
+
+#include "simple_robot_app_control.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL
+#define KERNEL_NAME "fixed"
+#define TRACK_TOL   1e-5f                                  /* rad */
+#define LSB         (1.0f / (float)SIMPLE_ROBOT_APP_Q_ONE) /* rad */
+#else
+#define KERNEL_NAME "float"
+#define TRACK_TOL   0.0f
+#define LSB         0.0f
+#endif
+
+#define MAX_TICKS 20000
+
+static int Failures = 0;
+
+#define CHECK(Cond, ...)                                 \
+    do                                                   \
+    {                                                    \
+        if (!(Cond))                                     \
+        {                                                \
+            Failures++;                                  \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__);                         \
+            printf("\n");                                \
+        }                                                \
+    } while (0)
+
+static void ToArray(const SimpleRobotAppJointConfig_t *Joints, float Out[SIMPLE_ROBOT_APP_NUM_JOINTS])
+{
+    Out[0] = Joints->shoulder_pan_joint;
+    Out[1] = Joints->shoulder_lift_joint;
+    Out[2] = Joints->elbow_joint;
+    Out[3] = Joints->wrist_1_joint;
+    Out[4] = Joints->wrist_2_joint;
+    Out[5] = Joints->wrist_3_joint;
+}
+
+static SimpleRobotAppJointConfig_t FromArray(const float In[SIMPLE_ROBOT_APP_NUM_JOINTS])
+{
+    SimpleRobotAppJointConfig_t Joints;
+
+    Joints.shoulder_pan_joint  = In[0];
+    Joints.shoulder_lift_joint = In[1];
+    Joints.elbow_joint         = In[2];
+    Joints.wrist_1_joint       = In[3];
+    Joints.wrist_2_joint       = In[4];
+    Joints.wrist_3_joint       = In[5];
+    return Joints;
+}
+
+static float MaxAbsDiff(const float A[SIMPLE_ROBOT_APP_NUM_JOINTS], const float B[SIMPLE_ROBOT_APP_NUM_JOINTS])
+{
+    float Max = 0.0f;
+    int   i;
+
+    for (i = 0; i < SIMPLE_ROBOT_APP_NUM_JOINTS; i++)
+    {
+        Max = fmaxf(Max, fabsf(A[i] - B[i]));
+    }
+    return Max;
+}
+
+/* One HR tick, then read the state back in radians as telemetry would */
+static bool StepAndGetState(SimpleRobotAppControl_t *Ctl, const SimpleRobotAppJointConfig_t *Goal,
+                            SimpleRobotAppJointConfig_t *State)
+{
+    bool Converged = SimpleRobotAppControlStep(Ctl, Goal);
+
+    SimpleRobotAppControlGetState(Ctl, State);
+    return Converged;
+}
+
+/* The controller as specified: state += Kp * (goal - state), in float */
+static void ReferenceStep(const float Goal[SIMPLE_ROBOT_APP_NUM_JOINTS], float State[SIMPLE_ROBOT_APP_NUM_JOINTS])
+{
+    const float Kp = SIMPLE_ROBOT_APP_CONTROL_KP;
+    int         i;
+
+    for (i = 0; i < SIMPLE_ROBOT_APP_NUM_JOINTS; i++)
+    {
+        State[i] += Kp * (Goal[i] - State[i]);
+    }
+}
+
+/*
+** Drive kernel and reference through a sequence of goals, retargeting
+** mid-motion, and check the kernel never strays from the reference.
+*/
+static void TestTracksReference(void)
+{
+    static const float Goals[][SIMPLE_ROBOT_APP_NUM_JOINTS] = {
+        {1.5f, -3.1f, 6.2f, -6.2f, 0.001f, 2.0f},
+        {-0.7f, 0.0f, 3.14159f, 1.0f, -2.5f, 0.25f},
+        {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+    };
+    SimpleRobotAppControl_t     Ctl;
+    SimpleRobotAppJointConfig_t Goal;
+    SimpleRobotAppJointConfig_t State;
+    float                       RefState[SIMPLE_ROBOT_APP_NUM_JOINTS] = {0};
+    float                       KernelState[SIMPLE_ROBOT_APP_NUM_JOINTS];
+    float                       MaxErr = 0.0f;
+    unsigned int                g;
+    int                         Tick;
+
+    SimpleRobotAppControlInit(&Ctl);
+
+    for (g = 0; g < sizeof(Goals) / sizeof(Goals[0]); g++)
+    {
+        Goal = FromArray(Goals[g]);
+        SimpleRobotAppControlSetGoal(&Ctl, &Goal);
+
+        /* Not long enough to converge, so the next goal arrives mid-motion */
+        for (Tick = 0; Tick < 300; Tick++)
+        {
+            StepAndGetState(&Ctl, &Goal, &State);
+            ReferenceStep(Goals[g], RefState);
+
+            ToArray(&State, KernelState);
+            MaxErr = fmaxf(MaxErr, MaxAbsDiff(KernelState, RefState));
+        }
+    }
+
+    CHECK(MaxErr <= TRACK_TOL, "tracking error %g rad > %g", MaxErr, TRACK_TOL);
+    printf("  tracks reference: max error %g rad\n", MaxErr);
+}
+
+/*
+** Both should reach the goal in about the same number of ticks and agree
+** on where they stopped.
+*/
+static void TestConvergesLikeReference(void)
+{
+    static const float          GoalArray[SIMPLE_ROBOT_APP_NUM_JOINTS] = {1.5f, -3.1f, 6.2f, -6.2f, 0.001f, 2.0f};
+    const float                 Tolerance                              = 1e-4f;
+    SimpleRobotAppControl_t     Ctl;
+    SimpleRobotAppJointConfig_t Goal = FromArray(GoalArray);
+    SimpleRobotAppJointConfig_t State;
+    float                       RefState[SIMPLE_ROBOT_APP_NUM_JOINTS] = {0};
+    float                       KernelState[SIMPLE_ROBOT_APP_NUM_JOINTS];
+    int                         KernelTicks = -1;
+    int                         RefTicks    = -1;
+    int                         Tick;
+
+    SimpleRobotAppControlInit(&Ctl);
+    SimpleRobotAppControlSetTolerance(&Ctl, Tolerance);
+    SimpleRobotAppControlSetGoal(&Ctl, &Goal);
+
+    for (Tick = 1; Tick <= MAX_TICKS && KernelTicks < 0; Tick++)
+    {
+        if (StepAndGetState(&Ctl, &Goal, &State))
+        {
+            KernelTicks = Tick;
+        }
+    }
+    for (Tick = 1; Tick <= MAX_TICKS && RefTicks < 0; Tick++)
+    {
+        ReferenceStep(GoalArray, RefState);
+        if (MaxAbsDiff(GoalArray, RefState) <= Tolerance)
+        {
+            RefTicks = Tick;
+        }
+    }
+
+    CHECK(KernelTicks > 0, "kernel never converged");
+    CHECK(RefTicks > 0, "reference never converged");
+    CHECK(abs(KernelTicks - RefTicks) <= RefTicks / 100 + 1, "converged in %d ticks, reference %d", KernelTicks,
+          RefTicks);
+
+    ToArray(&State, KernelState);
+    /* Each is within Tolerance of the goal */
+    CHECK(MaxAbsDiff(KernelState, RefState) <= 2 * Tolerance,
+          "final state differs from reference by %g rad", MaxAbsDiff(KernelState, RefState));
+    printf("  converged in %d ticks (reference %d), final difference %g rad\n", KernelTicks, RefTicks,
+           MaxAbsDiff(KernelState, RefState));
+}
+
+/*
+** Convergence is reported on the first tick the error is within the
+** tolerance (to within the tolerance's own conversion error), and never
+** with a zero tolerance.
+*/
+static void TestTolerance(void)
+{
+    static const float Tolerances[] = {1e-2f, 1e-3f, 2.5e-4f};
+    static const float GoalArray[SIMPLE_ROBOT_APP_NUM_JOINTS] = {0.5f, -1.25f, 2.0f, 0.0f, -0.3f, 1.0f};
+    SimpleRobotAppControl_t     Ctl;
+    SimpleRobotAppJointConfig_t Goal = FromArray(GoalArray);
+    SimpleRobotAppJointConfig_t State;
+    float                       KernelState[SIMPLE_ROBOT_APP_NUM_JOINTS];
+    float                       PrevErr;
+    float                       Err;
+    unsigned int                t;
+    int                         Tick;
+    bool                        Converged;
+
+    for (t = 0; t < sizeof(Tolerances) / sizeof(Tolerances[0]); t++)
+    {
+        SimpleRobotAppControlInit(&Ctl);
+        SimpleRobotAppControlSetTolerance(&Ctl, Tolerances[t]);
+        SimpleRobotAppControlSetGoal(&Ctl, &Goal);
+        PrevErr   = MaxAbsDiff(GoalArray, (const float[SIMPLE_ROBOT_APP_NUM_JOINTS]){0});
+        Err       = PrevErr;
+        Converged = false;
+
+        for (Tick = 0; Tick < MAX_TICKS && !Converged; Tick++)
+        {
+            PrevErr   = Err;
+            Converged = StepAndGetState(&Ctl, &Goal, &State);
+            ToArray(&State, KernelState);
+            Err = MaxAbsDiff(GoalArray, KernelState);
+        }
+
+        CHECK(Converged, "tolerance %g: never converged", Tolerances[t]);
+        CHECK(Err <= Tolerances[t] + 2 * LSB, "tolerance %g: converged with error %g", Tolerances[t], Err);
+        CHECK(PrevErr > Tolerances[t] - 2 * LSB, "tolerance %g: missed convergence, previous error %g",
+              Tolerances[t], PrevErr);
+    }
+
+    /* Zero tolerance disables convergence */
+    SimpleRobotAppControlInit(&Ctl);
+    SimpleRobotAppControlSetTolerance(&Ctl, 0.0f);
+    SimpleRobotAppControlSetGoal(&Ctl, &Goal);
+    Converged = false;
+    for (Tick = 0; Tick < MAX_TICKS && !Converged; Tick++)
+    {
+        Converged = StepAndGetState(&Ctl, &Goal, &State);
+    }
+    CHECK(!Converged, "zero tolerance reported convergence");
+}
+
+#ifdef SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL
+/*
+** Goals at and beyond +/- SIMPLE_ROBOT_APP_Q_LIMIT_RAD are clamped, and the
+** largest possible swing (one limit to the other) does not overflow.
+*/
+static void TestClampAtLimit(void)
+{
+    const float                 Limit = SIMPLE_ROBOT_APP_Q_LIMIT_RAD;
+    static const float          Goals[] = {SIMPLE_ROBOT_APP_Q_LIMIT_RAD, -SIMPLE_ROBOT_APP_Q_LIMIT_RAD, 1000.0f, -1000.0f};
+    SimpleRobotAppControl_t     Ctl;
+    SimpleRobotAppJointConfig_t Goal;
+    SimpleRobotAppJointConfig_t State;
+    float                       GoalArray[SIMPLE_ROBOT_APP_NUM_JOINTS];
+    float                       KernelState[SIMPLE_ROBOT_APP_NUM_JOINTS];
+    float                       Before;
+    unsigned int                g;
+    int                         i;
+    int                         Tick;
+
+    SimpleRobotAppControlInit(&Ctl);
+    SimpleRobotAppControlSetTolerance(&Ctl, 1e-4f);
+    SimpleRobotAppControlGetState(&Ctl, &State);
+
+    for (g = 0; g < sizeof(Goals) / sizeof(Goals[0]); g++)
+    {
+        float Expected = fmaxf(-Limit, fminf(Limit, Goals[g]));
+
+        for (i = 0; i < SIMPLE_ROBOT_APP_NUM_JOINTS; i++)
+        {
+            GoalArray[i] = Goals[g];
+        }
+        Goal = FromArray(GoalArray);
+        SimpleRobotAppControlSetGoal(&Ctl, &Goal);
+
+        /* First step of a full-range swing must move toward the goal */
+        Before = State.shoulder_pan_joint;
+        StepAndGetState(&Ctl, &Goal, &State);
+        CHECK((Expected - Before) * (State.shoulder_pan_joint - Before) > 0.0f,
+              "goal %g: first step went from %g to %g", Goals[g], Before, State.shoulder_pan_joint);
+
+        for (Tick = 0; Tick < MAX_TICKS; Tick++)
+        {
+            StepAndGetState(&Ctl, &Goal, &State);
+        }
+
+        ToArray(&State, KernelState);
+        for (i = 0; i < SIMPLE_ROBOT_APP_NUM_JOINTS; i++)
+        {
+            CHECK(fabsf(KernelState[i] - Expected) <= 1e-4f, "goal %g: joint %d settled at %g, expected %g",
+                  Goals[g], i, KernelState[i], Expected);
+        }
+    }
+}
+#endif
+
+int main(void)
+{
+    printf("%s kernel, Kp = %g\n", KERNEL_NAME, (double)SIMPLE_ROBOT_APP_CONTROL_KP);
+
+    TestTracksReference();
+    TestConvergesLikeReference();
+    TestTolerance();
+#ifdef SIMPLE_ROBOT_APP_FIXED_POINT_CONTROL
+    TestClampAtLimit();
+#endif
+
+    printf("%s\n", Failures == 0 ? "PASS" : "FAILED");
+    return Failures == 0 ? 0 : 1;
+}
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,69 @@
+/*******************************************************************************
+**
+** File: cfe.h (host test shim)
+**
+** Purpose:
+**  Minimal stand-in for the cFE/OSAL headers so the cFE-independent parts of
+**  the app (controller kernels, SPSC queue, shared-memory writer) can be
+**  built and run on the host without a cFS mission tree.
+**
+** Notes:
+**  Only the types and calls those modules use are provided. Message headers
+**  are opaque byte arrays of the usual CCSDS primary + secondary sizes.
+**
+*******************************************************************************/
+#ifndef _simple_robot_app_host_cfe_h_
+#define _simple_robot_app_host_cfe_h_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int8_t   int8;
+typedef uint8_t  uint8;
+typedef int16_t  int16;
+typedef uint16_t uint16;
+typedef int32_t  int32;
+typedef uint32_t uint32;
+typedef int64_t  int64;
+typedef uint64_t uint64;
+
+typedef struct
+{
+    int64 ticks;
+} OS_time_t;
+
+typedef struct
+{
+    uint8 Byte[6];
+} CFE_MSG_Message_t;
+
+typedef struct
+{
+    CFE_MSG_Message_t Msg;
+    uint8             Sec[2];
+} CFE_MSG_CommandHeader_t;
+
+typedef struct
+{
+    CFE_MSG_Message_t Msg;
+    uint8             Sec[10];
+} CFE_MSG_TelemetryHeader_t;
+
+typedef union
+{
+    CFE_MSG_Message_t Msg;
+} CFE_SB_Buffer_t;
+
+#define CFE_SUCCESS                 0
+#define CFE_EVS_EventType_ERROR     3
+#define CFE_EVS_EventType_INFORMATION 2
+
+/* Provided by each host test; prints to stdout */
+int32 CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...);
+
+#endif /* _simple_robot_app_host_cfe_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
@@ -0,0 +1,226 @@
+/*******************************************************************************
+**
+** File: shm_bench.c
+**
+** Purpose:
+**   One writer against many readers on the shared-memory state segment.
+**
+** Notes:
+**   The writer thread calls SimpleRobotAppShmPublish back to back, which is
+**   far harsher than the app's one update per HR tick. For each reader
+**   count the benchmark reports read latency (first attempt to a
+**   consistent snapshot) and how often a read attempt raced the writer.
+**   Every snapshot is checked for tearing; any torn read fails the run.
+**
+**   Usage: shm_bench [max_readers] [seconds_per_step]
+**
+*******************************************************************************/
+
+/* pthreads, clock_gettime and nanosleep are POSIX, not ISO C */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "simple_robot_app_shm_writer.h"
+#include "simple_robot_app_shm.h"
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define MAX_READERS 64
+
+typedef struct
+{
+    pthread_t Thread;
+    uint64    Reads;
+    uint64    Attempts;
+    uint64    Torn;
+    uint64    TotalNsec;
+    uint64    MaxNsec;
+} ReaderStats_t;
+
+static volatile int StopFlag;
+
+int32 CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    va_list Args;
+
+    va_start(Args, Spec);
+    printf("EVS %u/%u: ", (unsigned int)EventID, (unsigned int)EventType);
+    vprintf(Spec, Args);
+    printf("\n");
+    va_end(Args);
+    return CFE_SUCCESS;
+}
+
+static uint64 NowNsec(void)
+{
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (uint64)Ts.tv_sec * 1000000000u + (uint64)Ts.tv_nsec;
+}
+
+/* Joint values are derived from the tick so readers can detect tearing */
+static float TickValue(uint32 Tick, int Joint)
+{
+    return (float)((Tick & 0xFFFF) * 8 + (uint32)Joint);
+}
+
+static void *WriterMain(void *Arg)
+{
+    SimpleRobotAppJointConfig_t Goal;
+    SimpleRobotAppJointConfig_t State;
+    uint32                      Tick = 0;
+
+    (void)Arg;
+    while (!__atomic_load_n(&StopFlag, __ATOMIC_RELAXED))
+    {
+        Tick++;
+        Goal.shoulder_pan_joint   = TickValue(Tick, 0);
+        Goal.shoulder_lift_joint  = TickValue(Tick, 1);
+        Goal.elbow_joint          = TickValue(Tick, 2);
+        Goal.wrist_1_joint        = TickValue(Tick, 3);
+        Goal.wrist_2_joint        = TickValue(Tick, 4);
+        Goal.wrist_3_joint        = TickValue(Tick, 5);
+        State.shoulder_pan_joint  = -Goal.shoulder_pan_joint;
+        State.shoulder_lift_joint = -Goal.shoulder_lift_joint;
+        State.elbow_joint         = -Goal.elbow_joint;
+        State.wrist_1_joint       = -Goal.wrist_1_joint;
+        State.wrist_2_joint       = -Goal.wrist_2_joint;
+        State.wrist_3_joint       = -Goal.wrist_3_joint;
+        SimpleRobotAppShmPublish(Tick, &Goal, &State);
+    }
+    return NULL;
+}
+
+static void *ReaderMain(void *Arg)
+{
+    ReaderStats_t                    *Stats = Arg;
+    const SimpleRobotAppShmSegment_t *Seg   = SimpleRobotAppShmAttach();
+    SimpleRobotAppShmState_t          Snapshot;
+    uint64                            Start;
+    uint64                            Nsec;
+    int                               i;
+
+    if (Seg == NULL)
+    {
+        printf("reader could not attach to %s\n", SIMPLE_ROBOT_APP_SHM_NAME);
+        Stats->Torn++;
+        return NULL;
+    }
+
+    while (!__atomic_load_n(&StopFlag, __ATOMIC_RELAXED))
+    {
+        Start = NowNsec();
+        do
+        {
+            Stats->Attempts++;
+        } while (!SimpleRobotAppShmTryRead(Seg, &Snapshot));
+        Nsec = NowNsec() - Start;
+
+        Stats->Reads++;
+        Stats->TotalNsec += Nsec;
+        if (Nsec > Stats->MaxNsec)
+        {
+            Stats->MaxNsec = Nsec;
+        }
+
+        if (Snapshot.tick != 0)
+        {
+            for (i = 0; i < SIMPLE_ROBOT_APP_SHM_JOINTS; i++)
+            {
+                if (Snapshot.goal[i] != TickValue(Snapshot.tick, i) || Snapshot.state[i] != -Snapshot.goal[i])
+                {
+                    Stats->Torn++;
+                    break;
+                }
+            }
+        }
+    }
+
+    SimpleRobotAppShmDetach(Seg);
+    return NULL;
+}
+
+static uint64 RunStep(int NumReaders, double Seconds)
+{
+    static ReaderStats_t Readers[MAX_READERS];
+    pthread_t            Writer;
+    struct timespec      Duration;
+    uint64               Reads     = 0;
+    uint64               Attempts  = 0;
+    uint64               Torn      = 0;
+    uint64               TotalNsec = 0;
+    uint64               MaxNsec   = 0;
+    int                  r;
+
+    StopFlag = 0;
+    pthread_create(&Writer, NULL, WriterMain, NULL);
+    for (r = 0; r < NumReaders; r++)
+    {
+        Readers[r] = (ReaderStats_t){0};
+        pthread_create(&Readers[r].Thread, NULL, ReaderMain, &Readers[r]);
+    }
+
+    Duration.tv_sec  = (time_t)Seconds;
+    Duration.tv_nsec = (long)((Seconds - (double)Duration.tv_sec) * 1e9);
+    nanosleep(&Duration, NULL);
+    __atomic_store_n(&StopFlag, 1, __ATOMIC_RELAXED);
+
+    pthread_join(Writer, NULL);
+    for (r = 0; r < NumReaders; r++)
+    {
+        pthread_join(Readers[r].Thread, NULL);
+        Reads += Readers[r].Reads;
+        Attempts += Readers[r].Attempts;
+        Torn += Readers[r].Torn;
+        TotalNsec += Readers[r].TotalNsec;
+        if (Readers[r].MaxNsec > MaxNsec)
+        {
+            MaxNsec = Readers[r].MaxNsec;
+        }
+    }
+
+    printf("%7d %12.0f %10.1f %10llu %11.4f%% %6llu\n", NumReaders, (double)Reads / Seconds,
+           Reads ? (double)TotalNsec / (double)Reads : 0.0, (unsigned long long)MaxNsec,
+           Attempts ? 100.0 * (double)(Attempts - Reads) / (double)Attempts : 0.0, (unsigned long long)Torn);
+
+    return Torn;
+}
+
+int main(int argc, char *argv[])
+{
+    int    MaxReaders = (argc > 1) ? atoi(argv[1]) : 4;
+    double Seconds    = (argc > 2) ? atof(argv[2]) : 1.0;
+    uint64 Torn       = 0;
+    int    NumReaders;
+
+    if (MaxReaders < 1 || MaxReaders > MAX_READERS || Seconds <= 0.0)
+    {
+        printf("usage: %s [max_readers 1..%d] [seconds_per_step]\n", argv[0], MAX_READERS);
+        return 2;
+    }
+
+    if (SimpleRobotAppShmOpen() != CFE_SUCCESS)
+    {
+        return 1;
+    }
+
+    printf("readers      reads/s  mean ns     max ns  retry rate   torn\n");
+    for (NumReaders = 1; NumReaders <= MaxReaders; NumReaders *= 2)
+    {
+        Torn += RunStep(NumReaders, Seconds);
+    }
+
+    SimpleRobotAppShmClose();
+
+    return Torn == 0 ? 0 : 1;
+}
+
+/************************/
+/*  End of File Comment */
+/************************/
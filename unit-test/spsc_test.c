@@ -0,0 +1,240 @@
+/*******************************************************************************
+**
+** File: spsc_test.c
+**
+** Purpose:
+**   Host test of the lock-free SPSC queue behind both goal hand-offs.
+**
+** Notes:
+**   Head and Tail are free-running uint32 counters, so the tests start them
+**   just short of the wrap to exercise full/empty detection across it.
+**
+*******************************************************************************/
+
+/* pthreads and sched_yield are POSIX, not ISO C */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "simple_robot_app_spsc.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#define DEPTH        8
+#define WRAP_START   (0xFFFFFFFFu - 2 * DEPTH) /* A few laps before Head/Tail wrap */
+#define THREAD_ITEMS 200000
+
+/* Not a power-of-two size, like the real segment */
+typedef struct
+{
+    uint32 Seq;
+    uint32 Check;
+    uint16 Pad;
+} Item_t;
+
+static int Failures = 0;
+
+#define CHECK(Cond, ...)                                 \
+    do                                                   \
+    {                                                    \
+        if (!(Cond))                                     \
+        {                                                \
+            Failures++;                                  \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+            printf(__VA_ARGS__);                         \
+            printf("\n");                                \
+        }                                                \
+    } while (0)
+
+static Item_t MakeItem(uint32 Seq)
+{
+    Item_t Item = {0};
+
+    Item.Seq   = Seq;
+    Item.Check = ~Seq;
+    return Item;
+}
+
+static void InitNearWrap(SimpleRobotAppSpsc_t *Queue, Item_t *Storage)
+{
+    SimpleRobotAppSpscInit(Queue, Storage, sizeof(Item_t), DEPTH);
+    Queue->Head = WRAP_START;
+    Queue->Tail = WRAP_START;
+}
+
+/*
+** Fill to Depth, check the next push is refused, drain in order, check the
+** next pop is refused. Enough laps to carry Head and Tail through zero.
+*/
+static void TestFullEmptyAcrossWrap(void)
+{
+    SimpleRobotAppSpsc_t Queue;
+    Item_t               Storage[DEPTH];
+    Item_t               Item;
+    uint32               Seq = 0;
+    uint32               Expect;
+    int                  Lap;
+    int                  i;
+
+    InitNearWrap(&Queue, Storage);
+    CHECK(!SimpleRobotAppSpscPop(&Queue, &Item), "pop from a new queue succeeded");
+
+    for (Lap = 0; Lap < 5; Lap++)
+    {
+        Expect = Seq;
+        for (i = 0; i < DEPTH; i++)
+        {
+            Item = MakeItem(Seq++);
+            CHECK(SimpleRobotAppSpscPush(&Queue, &Item), "lap %d: push %d refused before full", Lap, i);
+        }
+        Item = MakeItem(0xDEAD);
+        CHECK(!SimpleRobotAppSpscPush(&Queue, &Item), "lap %d: push onto a full queue succeeded", Lap);
+
+        for (i = 0; i < DEPTH; i++)
+        {
+            CHECK(SimpleRobotAppSpscPop(&Queue, &Item), "lap %d: pop %d refused before empty", Lap, i);
+            CHECK(Item.Seq == Expect && Item.Check == ~Expect, "lap %d: popped %u, expected %u", Lap,
+                  (unsigned int)Item.Seq, (unsigned int)Expect);
+            Expect++;
+        }
+        CHECK(!SimpleRobotAppSpscPop(&Queue, &Item), "lap %d: pop from an empty queue succeeded", Lap);
+    }
+
+    CHECK(Queue.Head < WRAP_START, "test never wrapped Head (at %u)", (unsigned int)Queue.Head);
+}
+
+/*
+** Partially filled queue straddling the wrap: interleaved pushes and pops
+** keep FIFO order and the fill level stays within Depth.
+*/
+static void TestInterleavedAcrossWrap(void)
+{
+    SimpleRobotAppSpsc_t Queue;
+    Item_t               Storage[DEPTH];
+    Item_t               Item;
+    uint32               Pushed = 0;
+    uint32               Popped = 0;
+    int                  Step;
+
+    InitNearWrap(&Queue, Storage);
+
+    for (Step = 0; Step < 10 * DEPTH; Step++)
+    {
+        /* Push three, pop two, until full; then drain one per step */
+        if (Step % 3 != 2)
+        {
+            Item = MakeItem(Pushed);
+            if (SimpleRobotAppSpscPush(&Queue, &Item))
+            {
+                Pushed++;
+            }
+            else
+            {
+                CHECK(Pushed - Popped == DEPTH, "push refused with %u queued", (unsigned int)(Pushed - Popped));
+            }
+        }
+        if (Step % 3 != 0 && SimpleRobotAppSpscPop(&Queue, &Item))
+        {
+            CHECK(Item.Seq == Popped, "popped %u, expected %u", (unsigned int)Item.Seq, (unsigned int)Popped);
+            Popped++;
+        }
+        CHECK(Queue.Tail - Queue.Head == Pushed - Popped, "fill level %u, expected %u",
+              (unsigned int)(Queue.Tail - Queue.Head), (unsigned int)(Pushed - Popped));
+    }
+}
+
+/*
+** Producer and consumer on their own threads: every item arrives, once, in
+** order, and intact.
+*/
+typedef struct
+{
+    SimpleRobotAppSpsc_t Queue;
+    Item_t               Storage[DEPTH];
+    uint32               Received;
+    uint32               OutOfOrder;
+    uint32               Corrupt;
+} ThreadTest_t;
+
+static void *ProducerMain(void *Arg)
+{
+    ThreadTest_t *Test = Arg;
+    Item_t        Item;
+    uint32        Seq;
+
+    for (Seq = 0; Seq < THREAD_ITEMS; Seq++)
+    {
+        Item = MakeItem(Seq);
+        while (!SimpleRobotAppSpscPush(&Test->Queue, &Item))
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *ConsumerMain(void *Arg)
+{
+    ThreadTest_t *Test = Arg;
+    Item_t        Item;
+
+    while (Test->Received < THREAD_ITEMS)
+    {
+        if (!SimpleRobotAppSpscPop(&Test->Queue, &Item))
+        {
+            sched_yield();
+            continue;
+        }
+        if (Item.Check != ~Item.Seq)
+        {
+            Test->Corrupt++;
+        }
+        if (Item.Seq != Test->Received)
+        {
+            Test->OutOfOrder++;
+        }
+        Test->Received++;
+    }
+    return NULL;
+}
+
+static void TestProducerConsumer(void)
+{
+    static ThreadTest_t Test;
+    pthread_t           Producer;
+    pthread_t           Consumer;
+    Item_t              Item;
+
+    InitNearWrap(&Test.Queue, Test.Storage);
+
+    pthread_create(&Consumer, NULL, ConsumerMain, &Test);
+    pthread_create(&Producer, NULL, ProducerMain, &Test);
+    pthread_join(Producer, NULL);
+    pthread_join(Consumer, NULL);
+
+    CHECK(Test.Received == THREAD_ITEMS, "received %u of %u items", (unsigned int)Test.Received,
+          (unsigned int)THREAD_ITEMS);
+    CHECK(Test.OutOfOrder == 0, "%u items out of order", (unsigned int)Test.OutOfOrder);
+    CHECK(Test.Corrupt == 0, "%u items corrupt", (unsigned int)Test.Corrupt);
+    CHECK(!SimpleRobotAppSpscPop(&Test.Queue, &Item), "queue not empty after the run");
+    printf("  producer/consumer: %u items, %u out of order, %u corrupt\n", (unsigned int)Test.Received,
+           (unsigned int)Test.OutOfOrder, (unsigned int)Test.Corrupt);
+}
+
+int main(void)
+{
+    printf("SPSC queue, depth %d\n", DEPTH);
+
+    TestFullEmptyAcrossWrap();
+    TestInterleavedAcrossWrap();
+    TestProducerConsumer();
+
+    printf("%s\n", Failures == 0 ? "PASS" : "FAILED");
+    return Failures == 0 ? 0 : 1;
+}
+
+/************************/
+/*  End of File Comment */
+/************************/